@@ -200,6 +200,9 @@ namespace OpenRCT2
             // NOTE: We must shutdown all systems here before Instance is set back to null.
             //       If objects use GetContext() in their destructor things won't go well.
 
+            // Finish writing a background autosave rather than leaving it to the destruction of statics.
+            GameWaitForAutosave();
+
 #ifdef ENABLE_SCRIPTING
             _scriptEngine.StopUnloadRegisterAllPlugins();
 #endif
@@ -701,6 +704,9 @@ namespace OpenRCT2
         {
             LOG_VERBOSE("Context::LoadParkFromFile(%s)", path.c_str());
 
+            // The file may be the autosave that is still being written.
+            GameWaitForAutosave();
+
             struct CrashAdditionalFileRegistration
             {
                 CrashAdditionalFileRegistration(const std::string& path)
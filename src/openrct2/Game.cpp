@@ -73,6 +73,7 @@
 #include "world/tile_element/SurfaceElement.h"
 
 #include <cstdio>
+#include <future>
 #include <iterator>
 #include <memory>
 
@@ -97,6 +98,8 @@ uint32_t gCurrentRealTimeTicks;
 static bool _mapChangedExpected;
 #endif
 
+static std::future<void> _autosaveWrite;
+
 using namespace OpenRCT2;
 
 void GameResetSpeed()
@@ -566,8 +569,19 @@ static void LimitAutosaveCount(const size_t numberOfFilesToKeep, bool processLan
     }
 }
 
+void GameWaitForAutosave()
+{
+    if (_autosaveWrite.valid())
+    {
+        _autosaveWrite.get();
+    }
+}
+
 void GameAutosave()
 {
+    // The previous autosave may still be written to the folder that is about to be cleaned up.
+    GameWaitForAutosave();
+
     auto subDirectory = DIRID::SAVE;
     const char* fileExtension = ".park";
     uint32_t saveFlags = 0x80000000;
@@ -605,6 +619,22 @@ void GameAutosave()
 
     auto& gameState = GetGameState();
 
+    if (Config::Get().general.BackgroundAutosave)
+    {
+        auto writeSave = ScenarioSaveDeferred(gameState, path, saveFlags);
+        if (!writeSave)
+        {
+            Console::Error::WriteLine("Could not autosave the scenario. Is the save folder writeable?");
+            return;
+        }
+
+        _autosaveWrite = std::async(std::launch::async, [writeSave = std::move(writeSave)]() {
+            if (!writeSave())
+                Console::Error::WriteLine("Could not autosave the scenario. Is the save folder writeable?");
+        });
+        return;
+    }
+
     if (!ScenarioSave(gameState, path, saveFlags))
         Console::Error::WriteLine("Could not autosave the scenario. Is the save folder writeable?");
 }
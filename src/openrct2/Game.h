@@ -174,6 +174,7 @@ void SaveGameAs();
 void SaveGameCmd(u8string_view name = {});
 void SaveGameWithName(u8string_view name);
 void GameAutosave();
+void GameWaitForAutosave();
 void RCT2StringToUTF8Self(char* buffer, size_t length);
 void GameFixSaveVars();
 void StartSilentRecord();
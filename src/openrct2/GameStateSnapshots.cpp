@@ -23,6 +23,8 @@
 #include "entity/Staff.h"
 #include "ride/Vehicle.h"
 
+#include <cstring>
+
 static constexpr size_t kMaximumGameStateSnapshots = 32;
 static constexpr uint32_t kInvalidTick = 0xFFFFFFFF;
 
@@ -39,12 +41,27 @@ union EntitySnapshot
 static_assert(sizeof(EntitySnapshot) == 0x200);
 #pragma pack(pop)
 
+// Where the data of an entity is in the stored sprites of a captured snapshot.
+struct EntityRecord
+{
+    uint32_t index;
+    uint32_t offset;
+    uint32_t length;
+};
+
 struct GameStateSnapshot_t
 {
     GameStateSnapshot_t& operator=(GameStateSnapshot_t&& mv) noexcept
     {
         tick = mv.tick;
+        srand0 = mv.srand0;
         storedSprites = std::move(mv.storedSprites);
+        parkParameters = std::move(mv.parkParameters);
+        isCaptured = mv.isCaptured;
+        entitiesOffset = mv.entitiesOffset;
+        entityRecords = std::move(mv.entityRecords);
+        isDelta = mv.isDelta;
+        delta = std::move(mv.delta);
         return *this;
     }
 
@@ -54,6 +71,15 @@ struct GameStateSnapshot_t
     OpenRCT2::MemoryStream storedSprites;
     OpenRCT2::MemoryStream parkParameters;
 
+    // Layout of the stored sprites, only known for snapshots captured from the game.
+    bool isCaptured = false;
+    uint32_t entitiesOffset = 0;
+    std::vector<EntityRecord> entityRecords;
+
+    // Set when the stored sprites have been dropped in favour of their difference to the next snapshot.
+    bool isDelta = false;
+    std::vector<uint8_t> delta;
+
     template<typename T>
     bool EntitySizeCheck(DataSerialiser& ds)
     {
@@ -79,6 +105,12 @@ struct GameStateSnapshot_t
         storedSprites.SetPosition(0);
         DataSerialiser ds(saving, storedSprites);
 
+        if (saving)
+        {
+            isCaptured = true;
+            entityRecords.clear();
+        }
+
         std::vector<uint32_t> indexTable;
         indexTable.reserve(numSprites);
 
@@ -105,6 +137,11 @@ struct GameStateSnapshot_t
         }
         ds << numSavedSprites;
 
+        if (saving)
+        {
+            entitiesOffset = static_cast<uint32_t>(storedSprites.GetPosition());
+        }
+
         if (loading)
         {
             indexTable.resize(numSavedSprites);
@@ -112,6 +149,7 @@ struct GameStateSnapshot_t
 
         for (uint32_t i = 0; i < numSavedSprites; i++)
         {
+            const auto recordOffset = static_cast<uint32_t>(storedSprites.GetPosition());
             ds << indexTable[i];
 
             const EntityId spriteIdx = EntityId::FromUnderlying(indexTable[i]);
@@ -159,19 +197,174 @@ struct GameStateSnapshot_t
                 default:
                     break;
             }
+
+            if (saving)
+            {
+                const auto recordLength = static_cast<uint32_t>(storedSprites.GetPosition()) - recordOffset;
+                entityRecords.push_back({ indexTable[i], recordOffset, recordLength });
+            }
         }
     }
 };
 
+// Differences between the entities of two snapshots are stored as runs of equal bytes followed by the
+// XOR of the bytes that changed, a run of either kind is at most this long.
+static constexpr size_t kMaxDeltaRun = 0xFFFF;
+
+static void WriteDeltaRun(std::vector<uint8_t>& delta, size_t length)
+{
+    delta.push_back(static_cast<uint8_t>(length));
+    delta.push_back(static_cast<uint8_t>(length >> 8));
+}
+
+static size_t ReadDeltaRun(const uint8_t*& delta)
+{
+    size_t length = delta[0] | (delta[1] << 8);
+    delta += 2;
+    return length;
+}
+
+// Appends the bytes of an entity as the difference to the bytes of the same entity in the next snapshot.
+static void EncodeEntityDelta(std::vector<uint8_t>& delta, const uint8_t* data, const uint8_t* nextData, size_t length)
+{
+    size_t pos = 0;
+    while (pos < length)
+    {
+        size_t equal = 0;
+        while (pos + equal < length && equal < kMaxDeltaRun && data[pos + equal] == nextData[pos + equal])
+            equal++;
+        pos += equal;
+
+        size_t changed = 0;
+        while (pos + changed < length && changed < kMaxDeltaRun && data[pos + changed] != nextData[pos + changed])
+            changed++;
+
+        WriteDeltaRun(delta, equal);
+        WriteDeltaRun(delta, changed);
+        for (size_t i = 0; i < changed; i++)
+        {
+            delta.push_back(data[pos + i] ^ nextData[pos + i]);
+        }
+        pos += changed;
+    }
+}
+
+static void DecodeEntityDelta(const uint8_t*& delta, uint8_t* data, const uint8_t* nextData, size_t length)
+{
+    size_t pos = 0;
+    while (pos < length)
+    {
+        const auto equal = ReadDeltaRun(delta);
+        std::memcpy(data + pos, nextData + pos, equal);
+        pos += equal;
+
+        const auto changed = ReadDeltaRun(delta);
+        for (size_t i = 0; i < changed; i++)
+        {
+            data[pos + i] = delta[i] ^ nextData[pos + i];
+        }
+        delta += changed;
+        pos += changed;
+    }
+}
+
+// Finds the record of the entity in the next snapshot, both lists are in entity order.
+static const EntityRecord* FindNextRecord(
+    const std::vector<EntityRecord>& nextRecords, size_t& nextIndex, const EntityRecord& record)
+{
+    while (nextIndex < nextRecords.size() && nextRecords[nextIndex].index < record.index)
+        nextIndex++;
+    if (nextIndex < nextRecords.size() && nextRecords[nextIndex].index == record.index
+        && nextRecords[nextIndex].length == record.length)
+    {
+        return &nextRecords[nextIndex];
+    }
+    return nullptr;
+}
+
+/*
+ * Replaces the stored sprites of the snapshot by their difference to the next snapshot. Entities are diffed
+ * against the same entity in the next snapshot, so spawned or removed entities do not shift the rest of the data,
+ * entities without a match of the same size are stored as they are.
+ */
+static void EncodeSnapshotDelta(GameStateSnapshot_t& snapshot, const GameStateSnapshot_t& next)
+{
+    const auto* data = static_cast<const uint8_t*>(snapshot.storedSprites.GetData());
+    const auto* nextData = static_cast<const uint8_t*>(next.storedSprites.GetData());
+
+    std::vector<uint8_t> delta;
+    delta.insert(delta.end(), data, data + snapshot.entitiesOffset);
+
+    size_t nextIndex = 0;
+    for (const auto& record : snapshot.entityRecords)
+    {
+        const auto* nextRecord = FindNextRecord(next.entityRecords, nextIndex, record);
+        if (nextRecord == nullptr)
+        {
+            delta.insert(delta.end(), data + record.offset, data + record.offset + record.length);
+        }
+        else
+        {
+            EncodeEntityDelta(delta, data + record.offset, nextData + nextRecord->offset, record.length);
+        }
+    }
+
+    snapshot.delta = std::move(delta);
+    snapshot.isDelta = true;
+    snapshot.storedSprites = OpenRCT2::MemoryStream{};
+}
+
+// Restores the stored sprites of a snapshot from its difference to the stored sprites of the next snapshot.
+static std::vector<uint8_t> DecodeSnapshotDelta(
+    const GameStateSnapshot_t& snapshot, const uint8_t* nextData, const GameStateSnapshot_t& next)
+{
+    const auto& records = snapshot.entityRecords;
+    const size_t length = records.empty() ? snapshot.entitiesOffset : records.back().offset + records.back().length;
+    std::vector<uint8_t> data(length);
+
+    const uint8_t* delta = snapshot.delta.data();
+    std::memcpy(data.data(), delta, snapshot.entitiesOffset);
+    delta += snapshot.entitiesOffset;
+
+    size_t nextIndex = 0;
+    for (const auto& record : records)
+    {
+        const auto* nextRecord = FindNextRecord(next.entityRecords, nextIndex, record);
+        if (nextRecord == nullptr)
+        {
+            std::memcpy(data.data() + record.offset, delta, record.length);
+            delta += record.length;
+        }
+        else
+        {
+            DecodeEntityDelta(delta, data.data() + record.offset, nextData + nextRecord->offset, record.length);
+        }
+    }
+    return data;
+}
+
 struct GameStateSnapshots final : public IGameStateSnapshots
 {
     virtual void Reset() override final
     {
         _snapshots.clear();
+        _restoredSnapshot.reset();
     }
 
     virtual GameStateSnapshot_t& CreateSnapshot() override final
     {
+        // The newest snapshot can still be captured or read into, the one before it is complete and can be
+        // reduced to its difference to the newest.
+        if (_snapshots.size() >= 2)
+        {
+            auto& previous = *_snapshots[_snapshots.size() - 2];
+            const auto& newest = *_snapshots[_snapshots.size() - 1];
+            if (previous.isCaptured && !previous.isDelta && newest.isCaptured && !newest.isDelta)
+            {
+                EncodeSnapshotDelta(previous, newest);
+            }
+        }
+
         auto snapshot = std::make_unique<GameStateSnapshot_t>();
         _snapshots.push_back(std::move(snapshot));
 
@@ -197,11 +390,39 @@ struct GameStateSnapshots final : public IGameStateSnapshots
         for (size_t i = 0; i < _snapshots.size(); i++)
         {
             if (_snapshots[i]->tick == tick)
-                return _snapshots[i].get();
+                return _snapshots[i]->isDelta ? &RestoreSnapshot(i) : _snapshots[i].get();
         }
         return nullptr;
     }
 
+    // Applies the differences from the first whole snapshot after the given one back to it.
+    const GameStateSnapshot_t& RestoreSnapshot(size_t index) const
+    {
+        size_t wholeIndex = index + 1;
+        while (_snapshots[wholeIndex]->isDelta)
+            wholeIndex++;
+
+        const auto& whole = *_snapshots[wholeIndex];
+        std::vector<uint8_t> data(
+            static_cast<const uint8_t*>(whole.storedSprites.GetData()),
+            static_cast<const uint8_t*>(whole.storedSprites.GetData()) + whole.storedSprites.GetLength());
+        for (size_t i = wholeIndex; i > index; i--)
+        {
+            data = DecodeSnapshotDelta(*_snapshots[i - 1], data.data(), *_snapshots[i]);
+        }
+
+        const auto& snapshot = *_snapshots[index];
+        _restoredSnapshot = std::make_unique<GameStateSnapshot_t>();
+        _restoredSnapshot->tick = snapshot.tick;
+        _restoredSnapshot->srand0 = snapshot.srand0;
+        _restoredSnapshot->storedSprites = OpenRCT2::MemoryStream(std::move(data));
+        _restoredSnapshot->parkParameters = OpenRCT2::MemoryStream(snapshot.parkParameters);
+        _restoredSnapshot->isCaptured = true;
+        _restoredSnapshot->entitiesOffset = snapshot.entitiesOffset;
+        _restoredSnapshot->entityRecords = snapshot.entityRecords;
+        return *_restoredSnapshot;
+    }
+
     virtual void SerialiseSnapshot(GameStateSnapshot_t& snapshot, DataSerialiser& ds) const override final
     {
         ds << snapshot.tick;
@@ -790,6 +1011,7 @@ struct GameStateSnapshots final : public IGameStateSnapshots
 
 private:
     CircularBuffer<std::unique_ptr<GameStateSnapshot_t>, kMaximumGameStateSnapshots> _snapshots;
+    mutable std::unique_ptr<GameStateSnapshot_t> _restoredSnapshot;
 };
 
 std::unique_ptr<IGameStateSnapshots> CreateGameStateSnapshots()
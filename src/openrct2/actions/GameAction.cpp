@@ -21,12 +21,14 @@
 #include "../network/network.h"
 #include "../platform/Platform.h"
 #include "../profiling/Profiling.h"
+#include "../ride/RideRatings.h"
 #include "../scenario/Scenario.h"
 #include "../scripting/Duktape.hpp"
 #include "../scripting/HookEngine.h"
 #include "../scripting/ScriptEngine.h"
 #include "../ui/UiContext.h"
 #include "../ui/WindowManager.h"
+#include "../world/Map.h"
 #include "../world/Park.h"
 #include "../world/Scenery.h"
 
@@ -95,6 +97,8 @@ namespace OpenRCT2::GameActions
 
     void ProcessQueue()
     {
+        PROFILED_FUNCTION();
+
         if (_suspended)
         {
             // Do nothing if suspended, this is usually the case between connect and map loads.
@@ -285,6 +289,80 @@ namespace OpenRCT2::GameActions
         NetworkAppendServerLog(text);
     }
 
+    enum class MapChange
+    {
+        None,
+        Local,
+        Any,
+    };
+
+    // Ride ratings cache the proximity walk of each ride, so every action that can change the map has to be known.
+    static MapChange GetMapChange(GameCommand type)
+    {
+        switch (type)
+        {
+            case GameCommand::TogglePause:
+            case GameCommand::LoadOrQuit:
+            case GameCommand::SetRideAppearance:
+            case GameCommand::SetRideStatus:
+            case GameCommand::SetRideName:
+            case GameCommand::SetRideSetting:
+            case GameCommand::SetRidePrice:
+            case GameCommand::SetGuestName:
+            case GameCommand::SetStaffName:
+            case GameCommand::HireNewStaffMember:
+            case GameCommand::SetStaffPatrol:
+            case GameCommand::FireStaffMember:
+            case GameCommand::SetStaffOrders:
+            case GameCommand::SetParkName:
+            case GameCommand::SetParkOpen:
+            case GameCommand::SetParkEntranceFee:
+            case GameCommand::SetStaffColour:
+            case GameCommand::SetCurrentLoan:
+            case GameCommand::SetResearchFunding:
+            case GameCommand::StartMarketingCampaign:
+            case GameCommand::SetBannerName:
+            case GameCommand::SetSignName:
+            case GameCommand::SetPlayerGroup:
+            case GameCommand::ModifyGroups:
+            case GameCommand::KickPlayer:
+            case GameCommand::PickupGuest:
+            case GameCommand::PickupStaff:
+            case GameCommand::BalloonPress:
+            case GameCommand::EditScenarioOptions:
+            case GameCommand::SetClimate:
+            case GameCommand::SetColourScheme:
+            case GameCommand::SetStaffCostume:
+            case GameCommand::GuestSetFlags:
+            case GameCommand::SetDate:
+            case GameCommand::FreezeRideRating:
+            case GameCommand::SetGameSpeed:
+            case GameCommand::SetRestrictedScenery:
+                return MapChange::None;
+            case GameCommand::SetLandHeight:
+            case GameCommand::PlaceTrack:
+            case GameCommand::RemoveTrack:
+            case GameCommand::PlaceRideEntranceOrExit:
+            case GameCommand::RemoveRideEntranceOrExit:
+            case GameCommand::RemoveScenery:
+            case GameCommand::PlaceScenery:
+            case GameCommand::SetWaterHeight:
+            case GameCommand::PlacePath:
+            case GameCommand::RemovePath:
+            case GameCommand::SetBrakesSpeed:
+            case GameCommand::SetMazeTrack:
+            case GameCommand::PlaceWall:
+            case GameCommand::RemoveWall:
+            case GameCommand::PlaceBanner:
+            case GameCommand::RemoveBanner:
+            case GameCommand::PlaceFootpathAddition:
+            case GameCommand::RemoveFootpathAddition:
+                return MapChange::Local;
+            default:
+                return MapChange::Any;
+        }
+    }
+
     static GameActions::Result ExecuteInternal(const GameAction* action, bool topLevel)
     {
         Guard::ArgumentNotNull(action);
@@ -356,7 +434,23 @@ namespace OpenRCT2::GameActions
             LogActionBegin(logContext, action);
 
             // Execute the action, changing the game state
+            const auto mapChange = GetMapChange(action->GetType());
+            if (mapChange != MapChange::None)
+            {
+                RideRatingsFlushCachedWalks();
+            }
             result = action->Execute();
+            if (result.Error == GameActions::Status::Ok)
+            {
+                if (mapChange == MapChange::Local && !result.Position.IsNull())
+                {
+                    MapTileElementsChanged(result.Position);
+                }
+                else if (mapChange != MapChange::None)
+                {
+                    MapTileElementsChanged();
+                }
+            }
 #ifdef ENABLE_SCRIPTING
             if (result.Error == GameActions::Status::Ok)
             {
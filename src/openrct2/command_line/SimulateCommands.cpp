@@ -13,22 +13,74 @@
 #include "../OpenRCT2.h"
 #include "../config/ConfigTypes.h"
 #include "../core/Console.hpp"
+#include "../core/File.h"
+#include "../core/Json.hpp"
+#include "../core/Path.hpp"
+#include "../core/String.hpp"
 #include "../entity/EntityRegistry.h"
 #include "../network/network.h"
 #include "../platform/Platform.h"
+#include "../profiling/TickTimings.h"
 #include "CommandLine.hpp"
 
+#include <chrono>
 #include <cstdlib>
+#include <fstream>
 #include <memory>
+#include <vector>
 
 using namespace OpenRCT2;
 
+static bool _benchmark = false;
+static int32_t _warmupTicks = 0;
+static u8string _reportPath;
+
+// clang-format off
+static constexpr CommandLineOptionDefinition kSimulateOptions[]
+{
+    { CMDLINE_TYPE_SWITCH,  &_benchmark,   kNAC, "benchmark", "report the time spent per tick and per profiled function" },
+    { CMDLINE_TYPE_INTEGER, &_warmupTicks, kNAC, "warmup",    "number of ticks to run before measuring"                  },
+    { CMDLINE_TYPE_STRING,  &_reportPath,  kNAC, "report",    "write the timings to a .json or .csv file"                },
+    kOptionTableEnd
+};
+
+static constexpr CommandLineOptionDefinition kSimulateBatchOptions[]
+{
+    { CMDLINE_TYPE_INTEGER, &_warmupTicks, kNAC, "warmup",    "number of ticks to run before measuring"                  },
+    { CMDLINE_TYPE_STRING,  &_reportPath,  kNAC, "report",    "write checksums and timings to a .json or .csv file"      },
+    kOptionTableEnd
+};
+
 static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleSimulateBatch(CommandLineArgEnumerator* argEnumerator);
 
-const CommandLineCommand CommandLine::SimulateCommands[]{ // Main commands
-                                                          DefineCommand("", "<ticks>", nullptr, HandleSimulate),
-                                                          kCommandTableEnd
+const CommandLineCommand CommandLine::SimulateCommands[]
+{
+    // Main commands
+    DefineCommand("",      "<park> <ticks>",                        kSimulateOptions,      HandleSimulate     ),
+    DefineCommand("batch", "<ticks> <park|@park-list> [<park>...]", kSimulateBatchOptions, HandleSimulateBatch),
+    kCommandTableEnd
 };
+// clang-format on
+
+static bool WriteReport(const Profiling::TickTimings& timings, const u8string& path)
+{
+    bool result;
+    if (String::iequals(Path::GetExtension(path), ".csv"))
+    {
+        result = timings.ExportCSV(path);
+    }
+    else
+    {
+        result = timings.ExportJSON(path);
+    }
+
+    if (!result)
+    {
+        Console::Error::WriteLine("Unable to write report to %s", path.c_str());
+    }
+    return result;
+}
 
 static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
 {
@@ -43,6 +95,7 @@ static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
 
     const char* inputPath = argv[0];
     uint32_t ticks = atol(argv[1]);
+    const bool benchmark = _benchmark || !_reportPath.empty();
 
     gOpenRCT2Headless = true;
 
@@ -58,12 +111,44 @@ static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
             return EXITCODE_FAIL;
         }
 
+        if (_warmupTicks > 0)
+        {
+            Console::WriteLine("Running %d warmup ticks...", _warmupTicks);
+            for (int32_t i = 0; i < _warmupTicks; i++)
+            {
+                gameStateUpdateLogic();
+            }
+        }
+
+        Profiling::TickTimings timings;
+        if (benchmark)
+        {
+            Profiling::Enable();
+            timings.Begin();
+        }
+
         Console::WriteLine("Running %d ticks...", ticks);
         for (uint32_t i = 0; i < ticks; i++)
         {
+            const auto startTime = std::chrono::high_resolution_clock::now();
             gameStateUpdateLogic();
+            if (benchmark)
+            {
+                const auto elapsed = std::chrono::high_resolution_clock::now() - startTime;
+                timings.RecordTick(std::chrono::duration<double, std::micro>(elapsed).count());
+            }
         }
         Console::WriteLine("Completed: %s", GetAllEntitiesChecksum().ToString().c_str());
+
+        if (benchmark)
+        {
+            Profiling::Disable();
+            timings.PrintSummary();
+            if (!_reportPath.empty() && !WriteReport(timings, _reportPath))
+            {
+                return EXITCODE_FAIL;
+            }
+        }
     }
     else
     {
@@ -73,3 +158,193 @@ static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
 
     return EXITCODE_OK;
 }
+
+struct BatchResult
+{
+    u8string Path;
+    bool Success{};
+    u8string Checksum;
+    double LoadTimeMs{};
+    double SimulateTimeMs{};
+    Profiling::TimingStats TickStats;
+};
+
+static std::vector<u8string> GetBatchParkPaths(const char** argv, int32_t argc)
+{
+    std::vector<u8string> paths;
+    for (int32_t i = 0; i < argc; i++)
+    {
+        if (argv[i][0] == '-')
+            break;
+
+        // @file reads one park path per line.
+        if (argv[i][0] == '@')
+        {
+            for (auto& line : File::ReadAllLines(&argv[i][1]))
+            {
+                auto path = String::trim(line);
+                if (!path.empty())
+                {
+                    paths.push_back(std::move(path));
+                }
+            }
+        }
+        else
+        {
+            paths.emplace_back(argv[i]);
+        }
+    }
+    return paths;
+}
+
+static BatchResult SimulateBatchPark(IContext& context, const u8string& path, uint32_t ticks)
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    BatchResult result;
+    result.Path = path;
+
+    // Objects, sprites and the object repository stay loaded, only the park state is replaced.
+    const auto loadStartTime = Clock::now();
+    if (!context.LoadParkFromFile(path))
+    {
+        return result;
+    }
+    result.LoadTimeMs = std::chrono::duration<double, std::milli>(Clock::now() - loadStartTime).count();
+
+    for (int32_t i = 0; i < _warmupTicks; i++)
+    {
+        gameStateUpdateLogic();
+    }
+
+    std::vector<double> tickTimes;
+    tickTimes.reserve(ticks);
+    for (uint32_t i = 0; i < ticks; i++)
+    {
+        const auto startTime = Clock::now();
+        gameStateUpdateLogic();
+        tickTimes.push_back(std::chrono::duration<double, std::micro>(Clock::now() - startTime).count());
+    }
+
+    result.TickStats = Profiling::TimingStats::FromSamples(std::move(tickTimes));
+    result.SimulateTimeMs = result.TickStats.TotalUs / 1000.0;
+    result.Checksum = GetAllEntitiesChecksum().ToString();
+    result.Success = true;
+    return result;
+}
+
+static bool WriteBatchReport(const std::vector<BatchResult>& results, const u8string& path)
+{
+    if (String::iequals(Path::GetExtension(path), ".csv"))
+    {
+        std::ofstream out(path);
+        if (!out.is_open())
+        {
+            Console::Error::WriteLine("Unable to write report to %s", path.c_str());
+            return false;
+        }
+
+        out << "park;success;checksum;load_milliseconds;simulate_milliseconds;mean_tick_microseconds;"
+               "p99_tick_microseconds;max_tick_microseconds\n";
+        for (const auto& result : results)
+        {
+            out << "\"" << result.Path << "\";" << (result.Success ? 1 : 0) << ";" << result.Checksum << ";"
+                << result.LoadTimeMs << ";" << result.SimulateTimeMs << ";" << result.TickStats.MeanUs << ";"
+                << result.TickStats.P99Us << ";" << result.TickStats.MaxUs << "\n";
+        }
+        return true;
+    }
+
+    json_t report = json_t::array();
+    for (const auto& result : results)
+    {
+        report.push_back({
+            { "park", result.Path },
+            { "success", result.Success },
+            { "checksum", result.Checksum },
+            { "load_ms", result.LoadTimeMs },
+            { "simulate_ms", result.SimulateTimeMs },
+            { "mean_tick_us", result.TickStats.MeanUs },
+            { "p99_tick_us", result.TickStats.P99Us },
+            { "max_tick_us", result.TickStats.MaxUs },
+        });
+    }
+
+    try
+    {
+        Json::WriteToFile(path, report);
+    }
+    catch (const std::exception& e)
+    {
+        Console::Error::WriteLine("Unable to write report to %s: %s", path.c_str(), e.what());
+        return false;
+    }
+    return true;
+}
+
+static exitcode_t HandleSimulateBatch(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    if (argc < 2)
+    {
+        Console::Error::WriteLine("Missing arguments <ticks> <park>.");
+        return EXITCODE_FAIL;
+    }
+
+    uint32_t ticks = atol(argv[0]);
+    std::vector<u8string> parkPaths;
+    try
+    {
+        parkPaths = GetBatchParkPaths(argv + 1, argc - 1);
+    }
+    catch (const std::exception& e)
+    {
+        Console::Error::WriteLine("Unable to read park list: %s", e.what());
+        return EXITCODE_FAIL;
+    }
+    if (parkPaths.empty())
+    {
+        Console::Error::WriteLine("No parks to simulate.");
+        return EXITCODE_FAIL;
+    }
+
+    gOpenRCT2Headless = true;
+
+#ifndef DISABLE_NETWORK
+    gNetworkStart = NETWORK_MODE_SERVER;
+#endif
+
+    // Game state is global, so the parks run one after another in a single context.
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    std::vector<BatchResult> results;
+    bool allSucceeded = true;
+    for (const auto& path : parkPaths)
+    {
+        auto& result = results.emplace_back(SimulateBatchPark(*context, path, ticks));
+        if (result.Success)
+        {
+            Console::WriteLine(
+                "%s: %s (load %.1f ms, %u ticks in %.1f ms, p99 tick %.1f us)", path.c_str(), result.Checksum.c_str(),
+                result.LoadTimeMs, ticks, result.SimulateTimeMs, result.TickStats.P99Us);
+        }
+        else
+        {
+            Console::Error::WriteLine("%s: failed to load", path.c_str());
+            allSucceeded = false;
+        }
+    }
+
+    if (!_reportPath.empty() && !WriteBatchReport(results, _reportPath))
+    {
+        return EXITCODE_FAIL;
+    }
+    return allSucceeded ? EXITCODE_OK : EXITCODE_FAIL;
+}
@@ -222,6 +222,19 @@ namespace OpenRCT2::Config
 #else
             model->MultiThreading = reader->GetBoolean("multithreading", true);
 #endif // _DEBUG
+            model->GuestHotStateMirror = reader->GetBoolean("guest_hot_state_mirror", false);
+            model->IncrementalRideRatings = reader->GetBoolean("incremental_ride_ratings", false);
+            model->RideProximityIndex = reader->GetBoolean("ride_proximity_index", false);
+            model->CachePathCorridors = reader->GetBoolean("cache_path_corridors", false);
+            model->CacheTrackCircuits = reader->GetBoolean("cache_track_circuits", false);
+            model->IncrementalEntityChecksum = reader->GetBoolean("incremental_entity_checksum", false);
+            model->VerifyEntityChecksums = reader->GetBoolean("verify_entity_checksums", false);
+            model->BackgroundAutosave = reader->GetBoolean("background_autosave", false);
+            model->ParallelParkCompression = reader->GetBoolean("parallel_park_compression", false);
+            model->MapSpriteFiles = reader->GetBoolean("map_sprite_files", false);
+            model->CachePaintColumns = reader->GetBoolean("cache_paint_columns", false);
+            model->ArrayPaintSort = reader->GetBoolean("array_paint_sort", false);
+            model->ParallelPaintSort = reader->GetBoolean("parallel_paint_sort", false);
             model->TrapCursor = reader->GetBoolean("trap_cursor", false);
             model->AutoOpenShops = reader->GetBoolean("auto_open_shops", false);
             model->ScenarioSelectMode = reader->GetInt32("scenario_select_mode", SCENARIO_SELECT_MODE_ORIGIN);
@@ -314,6 +327,19 @@ namespace OpenRCT2::Config
         writer->WriteBoolean("infer_display_dpi", model->InferDisplayDPI);
         writer->WriteBoolean("show_fps", model->ShowFPS);
         writer->WriteBoolean("multithreading", model->MultiThreading);
+        writer->WriteBoolean("guest_hot_state_mirror", model->GuestHotStateMirror);
+        writer->WriteBoolean("incremental_ride_ratings", model->IncrementalRideRatings);
+        writer->WriteBoolean("ride_proximity_index", model->RideProximityIndex);
+        writer->WriteBoolean("cache_path_corridors", model->CachePathCorridors);
+        writer->WriteBoolean("cache_track_circuits", model->CacheTrackCircuits);
+        writer->WriteBoolean("incremental_entity_checksum", model->IncrementalEntityChecksum);
+        writer->WriteBoolean("verify_entity_checksums", model->VerifyEntityChecksums);
+        writer->WriteBoolean("background_autosave", model->BackgroundAutosave);
+        writer->WriteBoolean("parallel_park_compression", model->ParallelParkCompression);
+        writer->WriteBoolean("map_sprite_files", model->MapSpriteFiles);
+        writer->WriteBoolean("cache_paint_columns", model->CachePaintColumns);
+        writer->WriteBoolean("array_paint_sort", model->ArrayPaintSort);
+        writer->WriteBoolean("parallel_paint_sort", model->ParallelPaintSort);
         writer->WriteBoolean("trap_cursor", model->TrapCursor);
         writer->WriteBoolean("auto_open_shops", model->AutoOpenShops);
         writer->WriteInt32("scenario_select_mode", model->ScenarioSelectMode);
@@ -474,6 +500,7 @@ namespace OpenRCT2::Config
             model->LogServerActions = reader->GetBoolean("log_server_actions", false);
             model->PauseServerIfNoClients = reader->GetBoolean("pause_server_if_no_clients", false);
             model->DesyncDebugging = reader->GetBoolean("desync_debugging", false);
+            model->CacheMapForJoins = reader->GetBoolean("cache_map_for_joins", false);
         }
     }
 
@@ -501,6 +528,7 @@ namespace OpenRCT2::Config
         writer->WriteBoolean("log_server_actions", model->LogServerActions);
         writer->WriteBoolean("pause_server_if_no_clients", model->PauseServerIfNoClients);
         writer->WriteBoolean("desync_debugging", model->DesyncDebugging);
+        writer->WriteBoolean("cache_map_for_joins", model->CacheMapForJoins);
     }
 
     static void ReadNotifications(IIniReader* reader)
@@ -42,6 +42,19 @@ namespace OpenRCT2::Config
         bool UseVSync;
         bool ShowFPS;
         std::atomic_uint8_t MultiThreading;
+        bool GuestHotStateMirror;
+        bool IncrementalRideRatings;
+        bool RideProximityIndex;
+        bool CachePathCorridors;
+        bool CacheTrackCircuits;
+        bool IncrementalEntityChecksum;
+        bool VerifyEntityChecksums;
+        bool BackgroundAutosave;
+        bool ParallelParkCompression;
+        bool MapSpriteFiles;
+        bool CachePaintColumns;
+        bool ArrayPaintSort;
+        bool ParallelPaintSort;
         bool MinimizeFullscreenFocusLoss;
         bool DisableScreensaver;
 
@@ -180,6 +193,7 @@ namespace OpenRCT2::Config
         bool LogServerActions;
         bool PauseServerIfNoClients;
         bool DesyncDebugging;
+        bool CacheMapForJoins;
     };
 
     struct Notification
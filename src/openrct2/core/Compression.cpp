@@ -10,9 +10,13 @@
 #include "Compression.h"
 
 #include "../Diagnostic.h"
+#include "TaskScheduler.h"
 #include "zlib.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cstring>
 #include <stdexcept>
 #include <string>
 
@@ -173,4 +177,132 @@ namespace OpenRCT2::Compression
         inflateEnd(&strm);
         return output;
     }
+
+    constexpr size_t kBlockSize = 1024 * 1024;
+
+    // Layout of gzipBlocks output, followed by the compressed size of every block and the blocks themselves.
+    struct BlocksHeader
+    {
+        uint64_t UncompressedSize;
+        uint32_t BlockSize;
+        uint32_t NumBlocks;
+    };
+
+    std::vector<uint8_t> gzipBlocks(const void* data, const size_t dataLen)
+    {
+        assert(data != nullptr);
+
+        BlocksHeader header{};
+        header.UncompressedSize = dataLen;
+        header.BlockSize = static_cast<uint32_t>(kBlockSize);
+        header.NumBlocks = static_cast<uint32_t>((dataLen + kBlockSize - 1) / kBlockSize);
+
+        std::vector<std::vector<uint8_t>> blocks(header.NumBlocks);
+        std::atomic<bool> failed{};
+        TaskScheduler::GetShared().ParallelFor(0, blocks.size(), 1, [&](size_t first, size_t last) {
+            for (auto i = first; i < last; i++)
+            {
+                const auto offset = i * kBlockSize;
+                const auto length = std::min(kBlockSize, dataLen - offset);
+                try
+                {
+                    blocks[i] = gzip(static_cast<const uint8_t*>(data) + offset, length);
+                }
+                catch (const std::exception&)
+                {
+                    failed = true;
+                }
+            }
+        });
+        if (failed)
+        {
+            throw std::runtime_error("Failed to compress block");
+        }
+
+        size_t outputSize = sizeof(header) + blocks.size() * sizeof(uint64_t);
+        for (const auto& block : blocks)
+        {
+            outputSize += block.size();
+        }
+
+        std::vector<uint8_t> output(outputSize);
+        auto* dst = output.data();
+        std::memcpy(dst, &header, sizeof(header));
+        dst += sizeof(header);
+        for (const auto& block : blocks)
+        {
+            const uint64_t blockSize = block.size();
+            std::memcpy(dst, &blockSize, sizeof(blockSize));
+            dst += sizeof(blockSize);
+        }
+        for (const auto& block : blocks)
+        {
+            std::memcpy(dst, block.data(), block.size());
+            dst += block.size();
+        }
+        return output;
+    }
+
+    std::vector<uint8_t> ungzipBlocks(const void* data, const size_t dataLen)
+    {
+        assert(data != nullptr);
+
+        const auto* src = static_cast<const uint8_t*>(data);
+        BlocksHeader header{};
+        if (dataLen < sizeof(header))
+        {
+            throw std::runtime_error("Compressed blocks are truncated");
+        }
+        std::memcpy(&header, src, sizeof(header));
+
+        const auto tableSize = static_cast<size_t>(header.NumBlocks) * sizeof(uint64_t);
+        if (header.BlockSize == 0 || dataLen - sizeof(header) < tableSize
+            || header.UncompressedSize > static_cast<uint64_t>(header.NumBlocks) * header.BlockSize)
+        {
+            throw std::runtime_error("Compressed blocks are corrupt");
+        }
+
+        // Where each block starts within the data.
+        std::vector<size_t> blockOffsets(header.NumBlocks + 1);
+        blockOffsets[0] = sizeof(header) + tableSize;
+        for (uint32_t i = 0; i < header.NumBlocks; i++)
+        {
+            uint64_t blockSize;
+            std::memcpy(&blockSize, src + sizeof(header) + i * sizeof(uint64_t), sizeof(blockSize));
+            if (blockSize > dataLen - blockOffsets[i])
+            {
+                throw std::runtime_error("Compressed blocks are truncated");
+            }
+            blockOffsets[i + 1] = blockOffsets[i] + static_cast<size_t>(blockSize);
+        }
+
+        std::vector<uint8_t> output(static_cast<size_t>(header.UncompressedSize));
+        std::atomic<bool> failed{};
+        TaskScheduler::GetShared().ParallelFor(0, header.NumBlocks, 1, [&](size_t first, size_t last) {
+            for (auto i = first; i < last; i++)
+            {
+                const auto offset = i * header.BlockSize;
+                const auto length = std::min<size_t>(header.BlockSize, output.size() - std::min(offset, output.size()));
+                try
+                {
+                    auto block = ungzip(src + blockOffsets[i], blockOffsets[i + 1] - blockOffsets[i]);
+                    if (block.size() != length)
+                    {
+                        failed = true;
+                        continue;
+                    }
+                    std::memcpy(output.data() + offset, block.data(), block.size());
+                }
+                catch (const std::exception&)
+                {
+                    failed = true;
+                }
+            }
+        });
+        if (failed)
+        {
+            throw std::runtime_error("Failed to decompress block");
+        }
+        return output;
+    }
 } // namespace OpenRCT2::Compression
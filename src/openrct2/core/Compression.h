@@ -18,4 +18,8 @@ namespace OpenRCT2::Compression
     bool gzipCompress(FILE* source, FILE* dest);
     std::vector<uint8_t> gzip(const void* data, const size_t dataLen);
     std::vector<uint8_t> ungzip(const void* data, const size_t dataLen);
+
+    // Splits the data into blocks that are gzipped independently and in parallel.
+    std::vector<uint8_t> gzipBlocks(const void* data, const size_t dataLen);
+    std::vector<uint8_t> ungzipBlocks(const void* data, const size_t dataLen);
 } // namespace OpenRCT2::Compression
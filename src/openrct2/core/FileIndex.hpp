@@ -22,8 +22,10 @@
 
 #include <chrono>
 #include <list>
+#include <optional>
 #include <string>
-#include <tuple>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 template<typename TItem>
@@ -36,20 +38,42 @@ private:
         uint64_t TotalFileSize = 0;
         uint32_t FileDateModifiedChecksum = 0;
         uint32_t PathChecksum = 0;
+
+        bool operator==(const DirectoryStats&) const = default;
+    };
+
+    struct FileEntry
+    {
+        std::string Path;
+        uint64_t Size = 0;
+        uint64_t LastModified = 0;
     };
 
     struct ScanResult
     {
         DirectoryStats const Stats;
-        std::vector<std::string> const Files;
+        std::vector<FileEntry> const Files;
 
-        ScanResult(DirectoryStats stats, std::vector<std::string>&& files) noexcept
+        ScanResult(DirectoryStats stats, std::vector<FileEntry>&& files) noexcept
             : Stats(stats)
             , Files(std::move(files))
         {
         }
     };
 
+    // A file of the index and the item created from it, if it was valid.
+    struct IndexedFile
+    {
+        FileEntry File;
+        std::optional<TItem> Item;
+    };
+
+    struct IndexContents
+    {
+        DirectoryStats Stats;
+        std::vector<IndexedFile> Files;
+    };
+
     struct FileIndexHeader
     {
         uint32_t HeaderSize = sizeof(FileIndexHeader);
@@ -58,11 +82,11 @@ private:
         uint8_t VersionB = 0;
         uint16_t LanguageId = 0;
         DirectoryStats Stats;
-        uint32_t NumItems = 0;
+        uint32_t NumFiles = 0;
     };
 
     // Index file format version which when incremented forces a rebuild
-    static constexpr uint8_t kFileIndexVersion = 4;
+    static constexpr uint8_t kFileIndexVersion = 5;
 
     std::string const _name;
     uint32_t const _magicNumber;
@@ -98,31 +122,32 @@ public:
     virtual ~FileIndex() = default;
 
     /**
-     * Queries and directories and loads the index header. If the index is up to date,
-     * the items are loaded from the index and returned, otherwise the index is rebuilt.
+     * Queries and directories and loads the index. If the index is up to date, the items are
+     * loaded from the index and returned, otherwise only the items of the files that were
+     * added or changed since the index was written are created again.
      */
     std::vector<TItem> LoadOrBuild(int32_t language) const
     {
-        std::vector<TItem> items;
         auto scanResult = Scan();
-        auto readIndexResult = ReadIndexFile(language, scanResult.Stats);
-        if (std::get<0>(readIndexResult))
+        auto index = ReadIndexFile(language);
+        if (!index.has_value())
         {
-            // Index was loaded
-            items = std::get<1>(readIndexResult);
+            return Build(language, scanResult, {});
         }
-        else
+        if (index->Stats == scanResult.Stats)
         {
-            // Index was not loaded
-            items = Build(language, scanResult);
+            // Directory is the same, just use the saved items
+            return GetItems(index->Files);
         }
-        return items;
+
+        OpenRCT2::Console::WriteLine("%s out of date", _name.c_str());
+        return Build(language, scanResult, std::move(index->Files));
     }
 
     std::vector<TItem> Rebuild(int32_t language) const
     {
         auto scanResult = Scan();
-        auto items = Build(language, scanResult);
+        auto items = Build(language, scanResult, {});
         return items;
     }
 
@@ -141,7 +166,7 @@ private:
     ScanResult Scan() const
     {
         DirectoryStats stats{};
-        std::vector<std::string> files;
+        std::vector<FileEntry> files;
         for (const auto& directory : SearchPaths)
         {
             auto absoluteDirectory = OpenRCT2::Path::GetAbsolute(directory);
@@ -161,100 +186,150 @@ private:
                 stats.FileDateModifiedChecksum = OpenRCT2::Numerics::ror32(stats.FileDateModifiedChecksum, 5);
                 stats.PathChecksum += GetPathChecksum(path);
 
-                files.push_back(std::move(path));
+                files.push_back({ std::move(path), fileInfo.Size, fileInfo.LastModified });
             }
         }
         return ScanResult(stats, std::move(files));
     }
 
-    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult) const
+    /**
+     * Creates the items of the scanned files, reusing the items of previously indexed files whose
+     * size and modification time have not changed.
+     */
+    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult, std::vector<IndexedFile>&& previousFiles) const
     {
-        std::vector<TItem> allItems;
-        OpenRCT2::Console::WriteLine("Building %s (%zu items)", _name.c_str(), scanResult.Files.size());
+        std::unordered_map<std::string_view, IndexedFile*> previousFilesByPath;
+        previousFilesByPath.reserve(previousFiles.size());
+        for (auto& previousFile : previousFiles)
+        {
+            previousFilesByPath.emplace(previousFile.File.Path, &previousFile);
+        }
+
+        const size_t totalCount = scanResult.Files.size();
+        std::vector<IndexedFile> files(totalCount);
+        std::vector<size_t> changedFiles;
+        for (size_t i = 0; i < totalCount; i++)
+        {
+            const auto& file = scanResult.Files[i];
+            files[i].File = file;
+
+            auto it = previousFilesByPath.find(file.Path);
+            if (it != previousFilesByPath.end() && it->second->File.Size == file.Size
+                && it->second->File.LastModified == file.LastModified)
+            {
+                files[i].Item = std::move(it->second->Item);
+            }
+            else
+            {
+                changedFiles.push_back(i);
+            }
+        }
+
+        const bool isFullBuild = previousFiles.empty();
+        if (isFullBuild)
+        {
+            OpenRCT2::Console::WriteLine("Building %s (%zu items)", _name.c_str(), totalCount);
+        }
+        else
+        {
+            OpenRCT2::Console::WriteLine(
+                "Updating %s (%zu of %zu files changed)", _name.c_str(), changedFiles.size(), totalCount);
+        }
 
         auto startTime = std::chrono::high_resolution_clock::now();
 
-        const size_t totalCount = scanResult.Files.size();
-        if (totalCount > 0)
+        const size_t changedCount = changedFiles.size();
+        if (changedCount > 0)
         {
             JobPool jobPool;
-            std::mutex mtx;
             std::atomic<size_t> processed{ 0 };
 
-            for (size_t i = 0; i < totalCount; i++)
+            for (auto index : changedFiles)
             {
-                jobPool.AddTask([&, index = i]() {
-                    const auto& filePath = scanResult.Files.at(index);
-
-                    if (auto item = Create(language, filePath); item.has_value())
-                    {
-                        std::lock_guard lock(mtx);
-                        allItems.push_back(std::move(item.value()));
-                    }
-
+                jobPool.AddTask([&, index]() {
+                    // Each task writes to its own slot, no lock needed.
+                    files[index].Item = Create(language, files[index].File.Path);
                     processed++;
                 });
             }
 
             jobPool.Join([&]() {
-                OpenRCT2::GetContext()->SetProgress(static_cast<uint32_t>(processed.load()), static_cast<uint32_t>(totalCount));
+                OpenRCT2::GetContext()->SetProgress(static_cast<uint32_t>(processed.load()), static_cast<uint32_t>(changedCount));
             });
         }
 
-        WriteIndexFile(language, scanResult.Stats, allItems);
+        WriteIndexFile(language, scanResult.Stats, files);
 
         auto endTime = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration<float>(endTime - startTime);
-        OpenRCT2::Console::WriteLine("Finished building %s in %.2f seconds.", _name.c_str(), duration.count());
+        OpenRCT2::Console::WriteLine(
+            "Finished %s %s in %.2f seconds.", isFullBuild ? "building" : "updating", _name.c_str(), duration.count());
 
-        return allItems;
+        return GetItems(files);
     }
 
-    std::tuple<bool, std::vector<TItem>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    static std::vector<TItem> GetItems(std::vector<IndexedFile>& files)
     {
-        bool loadedItems = false;
         std::vector<TItem> items;
-        if (OpenRCT2::File::Exists(_indexPath))
+        items.reserve(files.size());
+        for (auto& file : files)
         {
-            try
+            if (file.Item.has_value())
             {
-                LOG_VERBOSE("FileIndex:Loading index: '%s'", _indexPath.c_str());
-                auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_OPEN);
-
-                // Read header, check if we need to re-scan
-                auto header = fs.ReadValue<FileIndexHeader>();
-                if (header.HeaderSize == sizeof(FileIndexHeader) && header.MagicNumber == _magicNumber
-                    && header.VersionA == kFileIndexVersion && header.VersionB == _version && header.LanguageId == language
-                    && header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
-                    && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
-                    && header.Stats.PathChecksum == stats.PathChecksum)
-                {
-                    items.reserve(header.NumItems);
-                    DataSerialiser ds(false, fs);
-                    // Directory is the same, just read the saved items
-                    for (uint32_t i = 0; i < header.NumItems; i++)
-                    {
-                        TItem item;
-                        Serialise(ds, item);
-                        items.emplace_back(std::move(item));
-                    }
-                    loadedItems = true;
-                }
-                else
-                {
-                    OpenRCT2::Console::WriteLine("%s out of date", _name.c_str());
-                }
+                items.push_back(std::move(*file.Item));
+            }
+        }
+        return items;
+    }
+
+    std::optional<IndexContents> ReadIndexFile(int32_t language) const
+    {
+        if (!OpenRCT2::File::Exists(_indexPath))
+            return std::nullopt;
+
+        try
+        {
+            LOG_VERBOSE("FileIndex:Loading index: '%s'", _indexPath.c_str());
+            auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_OPEN);
+
+            // Read header, items created by another version or for another language can not be reused
+            auto header = fs.ReadValue<FileIndexHeader>();
+            if (header.HeaderSize != sizeof(FileIndexHeader) || header.MagicNumber != _magicNumber
+                || header.VersionA != kFileIndexVersion || header.VersionB != _version || header.LanguageId != language)
+            {
+                OpenRCT2::Console::WriteLine("%s out of date", _name.c_str());
+                return std::nullopt;
             }
-            catch (const std::exception& e)
+
+            IndexContents contents;
+            contents.Stats = header.Stats;
+            contents.Files.resize(header.NumFiles);
+            DataSerialiser ds(false, fs);
+            for (auto& file : contents.Files)
             {
-                OpenRCT2::Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
-                OpenRCT2::Console::Error::WriteLine("%s", e.what());
+                bool hasItem = false;
+                ds << file.File.Path;
+                ds << file.File.Size;
+                ds << file.File.LastModified;
+                ds << hasItem;
+                if (hasItem)
+                {
+                    TItem item;
+                    Serialise(ds, item);
+                    file.Item = std::move(item);
+                }
             }
+            return contents;
         }
-        return std::make_tuple(loadedItems, std::move(items));
+        catch (const std::exception& e)
+        {
+            OpenRCT2::Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
+            OpenRCT2::Console::Error::WriteLine("%s", e.what());
+        }
+        return std::nullopt;
     }
 
-    void WriteIndexFile(int32_t language, const DirectoryStats& stats, const std::vector<TItem>& items) const
+    void WriteIndexFile(int32_t language, const DirectoryStats& stats, const std::vector<IndexedFile>& files) const
     {
         try
         {
@@ -269,14 +344,22 @@ private:
             header.VersionB = _version;
             header.LanguageId = language;
             header.Stats = stats;
-            header.NumItems = static_cast<uint32_t>(items.size());
+            header.NumFiles = static_cast<uint32_t>(files.size());
             fs.WriteValue(header);
 
             DataSerialiser ds(true, fs);
-            // Write items
-            for (const auto& item : items)
+            // Write files, including the ones without an item so they are not created again next time
+            for (const auto& file : files)
             {
-                Serialise(ds, item);
+                bool hasItem = file.Item.has_value();
+                ds << file.File.Path;
+                ds << file.File.Size;
+                ds << file.File.LastModified;
+                ds << hasItem;
+                if (hasItem)
+                {
+                    Serialise(ds, *file.Item);
+                }
             }
         }
         catch (const std::exception& e)
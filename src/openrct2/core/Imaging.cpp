@@ -164,93 +164,143 @@ namespace OpenRCT2::Imaging
         }
     }
 
-    static void WritePng(std::ostream& ostream, const Image& image)
+    class PngRowWriter final : public IImageRowWriter
     {
-        png_structp png_ptr = nullptr;
-        png_colorp png_palette = nullptr;
-        try
+    private:
+        std::unique_ptr<std::ofstream> _file;
+        png_structp _png{};
+        png_infop _info{};
+        png_colorp _palette{};
+
+    public:
+        PngRowWriter(std::ostream& ostream, const Image& header)
         {
-            png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, PngError, PngWarning);
-            if (png_ptr == nullptr)
+            Begin(ostream, header);
+        }
+
+        PngRowWriter(std::string_view path, const Image& header)
+            : _file(std::make_unique<std::ofstream>(fs::u8path(path), std::ios::binary))
+        {
+            Begin(*_file, header);
+        }
+
+        ~PngRowWriter() override
+        {
+            Release();
+        }
+
+        void WriteRows(const uint8_t* pixels, uint32_t numRows, uint32_t stride) override
+        {
+            // Set error handler
+            if (setjmp(png_jmpbuf(_png)))
             {
-                throw std::runtime_error("png_create_write_struct failed.");
+                throw std::runtime_error("PNG ERROR");
             }
 
-            png_text text_ptr[1];
-            text_ptr[0].key = const_cast<char*>("Software");
-            text_ptr[0].text = const_cast<char*>(gVersionInfoFull);
-            text_ptr[0].compression = PNG_TEXT_COMPRESSION_zTXt;
+            for (uint32_t y = 0; y < numRows; y++)
+            {
+                png_write_row(_png, const_cast<png_byte*>(pixels));
+                pixels += stride;
+            }
+        }
 
-            auto info_ptr = png_create_info_struct(png_ptr);
-            if (info_ptr == nullptr)
+        void Finish() override
+        {
+            if (setjmp(png_jmpbuf(_png)))
             {
-                throw std::runtime_error("png_create_info_struct failed.");
+                throw std::runtime_error("PNG ERROR");
             }
 
-            if (image.Depth == 8)
+            png_write_end(_png, nullptr);
+        }
+
+    private:
+        void Begin(std::ostream& ostream, const Image& header)
+        {
+            try
             {
-                if (!image.Palette.has_value())
+                _png = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, PngError, PngWarning);
+                if (_png == nullptr)
                 {
-                    throw std::runtime_error("Expected a palette for 8-bit image.");
+                    throw std::runtime_error("png_create_write_struct failed.");
                 }
 
-                // Set the palette
-                png_palette = static_cast<png_colorp>(png_malloc(png_ptr, PNG_MAX_PALETTE_LENGTH * sizeof(png_color)));
-                if (png_palette == nullptr)
+                png_text text_ptr[1];
+                text_ptr[0].key = const_cast<char*>("Software");
+                text_ptr[0].text = const_cast<char*>(gVersionInfoFull);
+                text_ptr[0].compression = PNG_TEXT_COMPRESSION_zTXt;
+
+                _info = png_create_info_struct(_png);
+                if (_info == nullptr)
                 {
-                    throw std::runtime_error("png_malloc failed.");
+                    throw std::runtime_error("png_create_info_struct failed.");
                 }
-                for (size_t i = 0; i < PNG_MAX_PALETTE_LENGTH; i++)
+
+                if (header.Depth == 8)
                 {
-                    const auto& entry = (*image.Palette)[i];
-                    png_palette[i].blue = entry.Blue;
-                    png_palette[i].green = entry.Green;
-                    png_palette[i].red = entry.Red;
+                    if (!header.Palette.has_value())
+                    {
+                        throw std::runtime_error("Expected a palette for 8-bit image.");
+                    }
+
+                    // Set the palette
+                    _palette = static_cast<png_colorp>(png_malloc(_png, PNG_MAX_PALETTE_LENGTH * sizeof(png_color)));
+                    if (_palette == nullptr)
+                    {
+                        throw std::runtime_error("png_malloc failed.");
+                    }
+                    for (size_t i = 0; i < PNG_MAX_PALETTE_LENGTH; i++)
+                    {
+                        const auto& entry = (*header.Palette)[i];
+                        _palette[i].blue = entry.Blue;
+                        _palette[i].green = entry.Green;
+                        _palette[i].red = entry.Red;
+                    }
+                    png_set_PLTE(_png, _info, _palette, PNG_MAX_PALETTE_LENGTH);
                 }
-                png_set_PLTE(png_ptr, info_ptr, png_palette, PNG_MAX_PALETTE_LENGTH);
-            }
 
-            png_set_write_fn(png_ptr, &ostream, PngWriteData, PngFlush);
+                png_set_write_fn(_png, &ostream, PngWriteData, PngFlush);
 
-            // Set error handler
-            if (setjmp(png_jmpbuf(png_ptr)))
-            {
-                throw std::runtime_error("PNG ERROR");
-            }
+                // Set error handler
+                if (setjmp(png_jmpbuf(_png)))
+                {
+                    throw std::runtime_error("PNG ERROR");
+                }
 
-            // Write header
-            auto colourType = PNG_COLOR_TYPE_RGB_ALPHA;
-            if (image.Depth == 8)
-            {
-                png_byte transparentIndex = 0;
-                png_set_tRNS(png_ptr, info_ptr, &transparentIndex, 1, nullptr);
-                colourType = PNG_COLOR_TYPE_PALETTE;
+                // Write header
+                auto colourType = PNG_COLOR_TYPE_RGB_ALPHA;
+                if (header.Depth == 8)
+                {
+                    png_byte transparentIndex = 0;
+                    png_set_tRNS(_png, _info, &transparentIndex, 1, nullptr);
+                    colourType = PNG_COLOR_TYPE_PALETTE;
+                }
+                png_set_text(_png, _info, text_ptr, 1);
+                png_set_IHDR(
+                    _png, _info, header.Width, header.Height, 8, colourType, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
+                    PNG_FILTER_TYPE_DEFAULT);
+                png_write_info(_png, _info);
             }
-            png_set_text(png_ptr, info_ptr, text_ptr, 1);
-            png_set_IHDR(
-                png_ptr, info_ptr, image.Width, image.Height, 8, colourType, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
-                PNG_FILTER_TYPE_DEFAULT);
-            png_write_info(png_ptr, info_ptr);
-
-            // Write pixels
-            auto pixels = image.Pixels.data();
-            for (uint32_t y = 0; y < image.Height; y++)
+            catch (const std::exception&)
             {
-                png_write_row(png_ptr, const_cast<png_byte*>(pixels));
-                pixels += image.Stride;
+                Release();
+                throw;
             }
-
-            png_write_end(png_ptr, nullptr);
-            png_destroy_info_struct(png_ptr, &info_ptr);
-            png_free(png_ptr, png_palette);
-            png_destroy_write_struct(&png_ptr, nullptr);
         }
-        catch (const std::exception&)
+
+        void Release()
         {
-            png_free(png_ptr, png_palette);
-            png_destroy_write_struct(&png_ptr, nullptr);
-            throw;
+            png_free(_png, _palette);
+            _palette = nullptr;
+            png_destroy_write_struct(&_png, &_info);
         }
+    };
+
+    static void WritePng(std::ostream& ostream, const Image& image)
+    {
+        PngRowWriter writer(ostream, image);
+        writer.WriteRows(image.Pixels.data(), image.Height, image.Stride);
+        writer.Finish();
     }
 
     IMAGE_FORMAT GetImageFormatFromPath(std::string_view path)
@@ -342,4 +392,9 @@ namespace OpenRCT2::Imaging
                 throw std::runtime_error(kExceptionImageFormatUnknown);
         }
     }
+
+    std::unique_ptr<IImageRowWriter> CreatePngRowWriter(std::string_view path, const Image& header)
+    {
+        return std::make_unique<PngRowWriter>(path, header);
+    }
 } // namespace OpenRCT2::Imaging
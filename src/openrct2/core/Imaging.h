@@ -46,10 +46,26 @@ using ImageReaderFunc = std::function<Image(std::istream&, IMAGE_FORMAT)>;
 
 namespace OpenRCT2::Imaging
 {
+    /**
+     * Writes an image to a file in blocks of rows, so the whole image never has to be held in memory.
+     */
+    struct IImageRowWriter
+    {
+        virtual ~IImageRowWriter() = default;
+
+        virtual void WriteRows(const uint8_t* pixels, uint32_t numRows, uint32_t stride) = 0;
+
+        // Must be called once every row has been written, the file is incomplete otherwise.
+        virtual void Finish() = 0;
+    };
+
     IMAGE_FORMAT GetImageFormatFromPath(std::string_view path);
     Image ReadFromFile(std::string_view path, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
     Image ReadFromBuffer(const std::vector<uint8_t>& buffer, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
     void WriteToFile(std::string_view path, const Image& image, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
 
     void SetReader(IMAGE_FORMAT format, ImageReaderFunc impl);
+
+    // Only the size, depth and palette of the header are used, its pixels are passed to the writer.
+    std::unique_ptr<IImageRowWriter> CreatePngRowWriter(std::string_view path, const Image& header);
 } // namespace OpenRCT2::Imaging
@@ -0,0 +1,105 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "IStream.hpp"
+#include "MemoryMappedFile.h"
+#include "String.hpp"
+
+namespace OpenRCT2
+{
+#ifdef _WIN32
+    MemoryMappedFile::MemoryMappedFile(u8string_view path)
+    {
+        auto pathW = String::toWideChar(path);
+        HANDLE file = CreateFileW(
+            pathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw IOException(String::stdFormat("Unable to open '%s'", u8string(path).c_str()));
+        }
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+        {
+            CloseHandle(file);
+            throw IOException(String::stdFormat("Unable to map '%s'", u8string(path).c_str()));
+        }
+
+        // The mapping keeps the file open, the handle to the file itself is no longer needed.
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr)
+        {
+            throw IOException(String::stdFormat("Unable to map '%s'", u8string(path).c_str()));
+        }
+
+        auto* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (view == nullptr)
+        {
+            CloseHandle(mapping);
+            throw IOException(String::stdFormat("Unable to map '%s'", u8string(path).c_str()));
+        }
+
+        _data = static_cast<const uint8_t*>(view);
+        _size = static_cast<size_t>(fileSize.QuadPart);
+        _mappingHandle = mapping;
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        UnmapViewOfFile(_data);
+        CloseHandle(_mappingHandle);
+    }
+#else
+    MemoryMappedFile::MemoryMappedFile(u8string_view path)
+    {
+        int fd = open(u8string(path).c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            throw IOException(String::stdFormat("Unable to open '%s'", u8string(path).c_str()));
+        }
+
+        struct stat statInfo{};
+        if (fstat(fd, &statInfo) != 0 || statInfo.st_size == 0)
+        {
+            close(fd);
+            throw IOException(String::stdFormat("Unable to map '%s'", u8string(path).c_str()));
+        }
+
+        // The mapping keeps the file open, the descriptor is no longer needed.
+        const auto size = static_cast<size_t>(statInfo.st_size);
+        void* view = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (view == MAP_FAILED)
+        {
+            throw IOException(String::stdFormat("Unable to map '%s'", u8string(path).c_str()));
+        }
+
+        _data = static_cast<const uint8_t*>(view);
+        _size = size;
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        munmap(const_cast<uint8_t*>(_data), _size);
+    }
+#endif
+} // namespace OpenRCT2
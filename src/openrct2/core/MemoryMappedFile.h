@@ -0,0 +1,49 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "StringTypes.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace OpenRCT2
+{
+    /**
+     * A read-only view of a whole file mapped into memory. Pages are only read from disk when first
+     * accessed and are shared with every other process mapping the same file.
+     */
+    class MemoryMappedFile final
+    {
+    private:
+        const uint8_t* _data = nullptr;
+        size_t _size = 0;
+#ifdef _WIN32
+        void* _mappingHandle = nullptr;
+#endif
+
+    public:
+        explicit MemoryMappedFile(u8string_view path);
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        const uint8_t* GetData() const
+        {
+            return _data;
+        }
+
+        size_t GetSize() const
+        {
+            return _size;
+        }
+    };
+} // namespace OpenRCT2
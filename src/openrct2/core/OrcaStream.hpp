@@ -40,6 +40,8 @@ namespace OpenRCT2
         {
             none,
             gzip,
+            // Blocks of the data gzipped independently, so they can be compressed and decompressed in parallel.
+            gzipBlocks,
         };
 
     private:
@@ -66,6 +68,73 @@ namespace OpenRCT2
         };
 #pragma pack(pop)
 
+    public:
+        /**
+         * The chunks of a stream that has been written to memory, compressed and written out to a stream by Write.
+         * Lets the slow part of saving happen elsewhere, such as on a worker thread, with the same result.
+         */
+        class Image
+        {
+            friend class OrcaStream;
+
+            Header _header;
+            std::vector<ChunkEntry> _chunks;
+            MemoryStream _buffer;
+
+        public:
+            void Write(IStream& stream)
+            {
+                const void* uncompressedData = _buffer.GetData();
+                const uint64_t uncompressedSize = _buffer.GetLength();
+
+                _header.NumChunks = static_cast<uint32_t>(_chunks.size());
+                _header.UncompressedSize = uncompressedSize;
+                _header.CompressedSize = uncompressedSize;
+                _header.FNV1a = Crypt::FNV1a(uncompressedData, uncompressedSize);
+
+                // Compress data
+                std::optional<std::vector<uint8_t>> compressedBytes;
+                if (_header.Compression == CompressionType::gzip)
+                {
+                    compressedBytes = Compression::gzip(uncompressedData, uncompressedSize);
+                }
+                else if (_header.Compression == CompressionType::gzipBlocks)
+                {
+                    compressedBytes = Compression::gzipBlocks(uncompressedData, uncompressedSize);
+                }
+                if (_header.Compression != CompressionType::none)
+                {
+                    if (compressedBytes)
+                    {
+                        _header.CompressedSize = compressedBytes->size();
+                    }
+                    else
+                    {
+                        // Compression failed
+                        _header.Compression = CompressionType::none;
+                    }
+                }
+
+                // Write header and chunk table
+                stream.WriteValue(_header);
+                for (const auto& chunk : _chunks)
+                {
+                    stream.WriteValue(chunk);
+                }
+
+                // Write chunk data
+                if (compressedBytes)
+                {
+                    stream.Write(compressedBytes->data(), compressedBytes->size());
+                }
+                else
+                {
+                    stream.Write(uncompressedData, uncompressedSize);
+                }
+            }
+        };
+
+    private:
         IStream* _stream;
         Mode _mode;
         Header _header;
@@ -74,6 +143,15 @@ namespace OpenRCT2
         ChunkEntry _currentChunk;
 
     public:
+        // Writes the chunks to memory only, they have to be taken with TakeImage.
+        OrcaStream()
+            : _stream(nullptr)
+            , _mode(Mode::WRITING)
+        {
+            _header = {};
+            _header.Compression = CompressionType::gzip;
+        }
+
         OrcaStream(IStream& stream, const Mode mode)
         {
             _stream = &stream;
@@ -89,29 +167,27 @@ namespace OpenRCT2
                     _chunks.push_back(entry);
                 }
 
-                // Read compressed data into buffer (read in blocks)
-                _buffer = MemoryStream{};
-                uint8_t temp[2048];
-                uint64_t bytesLeft = _header.CompressedSize;
-                do
-                {
-                    auto readLen = std::min(size_t(bytesLeft), sizeof(temp));
-                    _stream->Read(temp, readLen);
-                    _buffer.Write(temp, readLen);
-                    bytesLeft -= readLen;
-                } while (bytesLeft > 0);
+                // Read compressed data
+                std::vector<uint8_t> compressedData(static_cast<size_t>(_header.CompressedSize));
+                _stream->Read(compressedData.data(), compressedData.size());
 
                 // Uncompress
-                if (_header.Compression == CompressionType::gzip)
+                _buffer = MemoryStream{};
+                if (_header.Compression == CompressionType::gzip || _header.Compression == CompressionType::gzipBlocks)
                 {
-                    auto uncompressedData = Compression::ungzip(_buffer.GetData(), _buffer.GetLength());
+                    auto uncompressedData = _header.Compression == CompressionType::gzip
+                        ? Compression::ungzip(compressedData.data(), compressedData.size())
+                        : Compression::ungzipBlocks(compressedData.data(), compressedData.size());
                     if (_header.UncompressedSize != uncompressedData.size())
                     {
                         // Warning?
                     }
-                    _buffer.Clear();
                     _buffer.Write(uncompressedData.data(), uncompressedData.size());
                 }
+                else
+                {
+                    _buffer.Write(compressedData.data(), compressedData.size());
+                }
             }
             else
             {
@@ -126,51 +202,25 @@ namespace OpenRCT2
 
         ~OrcaStream()
         {
-            if (_mode == Mode::WRITING)
+            if (_mode == Mode::WRITING && _stream != nullptr)
             {
-                const void* uncompressedData = _buffer.GetData();
-                const uint64_t uncompressedSize = _buffer.GetLength();
-
-                _header.NumChunks = static_cast<uint32_t>(_chunks.size());
-                _header.UncompressedSize = uncompressedSize;
-                _header.CompressedSize = uncompressedSize;
-                _header.FNV1a = Crypt::FNV1a(uncompressedData, uncompressedSize);
-
-                // Compress data
-                std::optional<std::vector<uint8_t>> compressedBytes;
-                if (_header.Compression == CompressionType::gzip)
-                {
-                    compressedBytes = Compression::gzip(uncompressedData, uncompressedSize);
-                    if (compressedBytes)
-                    {
-                        _header.CompressedSize = compressedBytes->size();
-                    }
-                    else
-                    {
-                        // Compression failed
-                        _header.Compression = CompressionType::none;
-                    }
-                }
-
-                // Write header and chunk table
-                _stream->WriteValue(_header);
-                for (const auto& chunk : _chunks)
-                {
-                    _stream->WriteValue(chunk);
-                }
-
-                // Write chunk data
-                if (compressedBytes)
-                {
-                    _stream->Write(compressedBytes->data(), compressedBytes->size());
-                }
-                else
-                {
-                    _stream->Write(uncompressedData, uncompressedSize);
-                }
+                TakeImage().Write(*_stream);
             }
         }
 
+        // Hands the chunks written so far over, nothing is written to the stream when the OrcaStream is destroyed.
+        Image TakeImage()
+        {
+            Image image;
+            image._header = _header;
+            image._chunks = std::move(_chunks);
+            image._buffer = std::move(_buffer);
+            _chunks.clear();
+            _buffer = MemoryStream{};
+            _stream = nullptr;
+            return image;
+        }
+
         Mode GetMode() const
         {
             return _mode;
@@ -0,0 +1,228 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+namespace OpenRCT2
+{
+    /**
+     * A set of identifiers in the range [0, TCapacity) that is always iterated in ascending order.
+     * Membership is stored as a bit per identifier with a second level of summary bits marking the
+     * non-empty words, so insert and erase are O(1) and finding the next member only scans a few words.
+     * Iterators look up the next member from the live set, removing the current member while iterating
+     * is therefore safe.
+     */
+    template<typename TId, size_t TCapacity>
+    class OrderedIdSet
+    {
+        using Word = uint64_t;
+
+        static constexpr size_t kBitsPerWord = 64;
+        static constexpr size_t kWordCount = (TCapacity + kBitsPerWord - 1) / kBitsPerWord;
+        static constexpr size_t kSummaryWordCount = (kWordCount + kBitsPerWord - 1) / kBitsPerWord;
+
+    public:
+        static constexpr size_t npos = TCapacity;
+
+        class const_iterator
+        {
+            const OrderedIdSet* _set{};
+            size_t _pos{};
+
+        public:
+            constexpr const_iterator() = default;
+
+            constexpr const_iterator(const OrderedIdSet* set, size_t pos)
+                : _set(set)
+                , _pos(pos)
+            {
+            }
+
+            constexpr TId operator*() const
+            {
+                return TId::FromUnderlying(static_cast<typename TId::UnderlyingType>(_pos));
+            }
+
+            constexpr bool operator==(const const_iterator& other) const
+            {
+                return _pos == other._pos;
+            }
+
+            constexpr bool operator!=(const const_iterator& other) const
+            {
+                return !(*this == other);
+            }
+
+            constexpr const_iterator& operator++()
+            {
+                _pos = _set->FindNext(_pos + 1);
+                return *this;
+            }
+
+            constexpr const_iterator operator++(int)
+            {
+                const_iterator res = *this;
+                ++(*this);
+                return res;
+            }
+
+            // iterator traits
+            using difference_type = std::ptrdiff_t;
+            using value_type = TId;
+            using pointer = const TId*;
+            using reference = const TId&;
+            using iterator_category = std::forward_iterator_tag;
+        };
+
+    private:
+        std::array<Word, kWordCount> _words{};
+        std::array<Word, kSummaryWordCount> _summary{};
+        size_t _count{};
+
+    public:
+        constexpr size_t size() const noexcept
+        {
+            return _count;
+        }
+
+        constexpr bool empty() const noexcept
+        {
+            return _count == 0;
+        }
+
+        constexpr size_t capacity() const noexcept
+        {
+            return TCapacity;
+        }
+
+        constexpr bool contains(TId id) const noexcept
+        {
+            const auto index = static_cast<size_t>(id.ToUnderlying());
+            if (index >= TCapacity)
+                return false;
+            return (_words[index / kBitsPerWord] & (Word{ 1 } << (index % kBitsPerWord))) != 0;
+        }
+
+        // Returns true if the identifier was not already a member.
+        constexpr bool insert(TId id) noexcept
+        {
+            const auto index = static_cast<size_t>(id.ToUnderlying());
+            if (index >= TCapacity)
+                return false;
+
+            const auto wordIndex = index / kBitsPerWord;
+            const auto bit = Word{ 1 } << (index % kBitsPerWord);
+            auto& word = _words[wordIndex];
+            if (word & bit)
+                return false;
+
+            word |= bit;
+            _summary[wordIndex / kBitsPerWord] |= Word{ 1 } << (wordIndex % kBitsPerWord);
+            _count++;
+            return true;
+        }
+
+        // Returns true if the identifier was a member.
+        constexpr bool erase(TId id) noexcept
+        {
+            const auto index = static_cast<size_t>(id.ToUnderlying());
+            if (index >= TCapacity)
+                return false;
+
+            const auto wordIndex = index / kBitsPerWord;
+            const auto bit = Word{ 1 } << (index % kBitsPerWord);
+            auto& word = _words[wordIndex];
+            if (!(word & bit))
+                return false;
+
+            word &= ~bit;
+            if (word == 0)
+            {
+                _summary[wordIndex / kBitsPerWord] &= ~(Word{ 1 } << (wordIndex % kBitsPerWord));
+            }
+            _count--;
+            return true;
+        }
+
+        constexpr void clear() noexcept
+        {
+            _words.fill(0);
+            _summary.fill(0);
+            _count = 0;
+        }
+
+        // Makes every identifier in the range a member.
+        constexpr void fill() noexcept
+        {
+            _words.fill(~Word{ 0 });
+            if constexpr ((TCapacity % kBitsPerWord) != 0)
+            {
+                _words.back() = (Word{ 1 } << (TCapacity % kBitsPerWord)) - 1;
+            }
+            _summary.fill(~Word{ 0 });
+            if constexpr ((kWordCount % kBitsPerWord) != 0)
+            {
+                _summary.back() = (Word{ 1 } << (kWordCount % kBitsPerWord)) - 1;
+            }
+            _count = TCapacity;
+        }
+
+        // Returns the first member at or after the given position, or npos if there is none.
+        constexpr size_t FindNext(size_t pos) const noexcept
+        {
+            if (pos >= TCapacity)
+                return npos;
+
+            auto wordIndex = pos / kBitsPerWord;
+            const auto word = _words[wordIndex] & (~Word{ 0 } << (pos % kBitsPerWord));
+            if (word != 0)
+                return wordIndex * kBitsPerWord + std::countr_zero(word);
+
+            // Use the summary to skip over empty words.
+            wordIndex++;
+            for (auto summaryIndex = wordIndex / kBitsPerWord; summaryIndex < kSummaryWordCount; summaryIndex++)
+            {
+                auto summary = _summary[summaryIndex];
+                if (summaryIndex == wordIndex / kBitsPerWord && (wordIndex % kBitsPerWord) != 0)
+                {
+                    summary &= ~Word{ 0 } << (wordIndex % kBitsPerWord);
+                }
+                if (summary != 0)
+                {
+                    const auto nextWordIndex = summaryIndex * kBitsPerWord + std::countr_zero(summary);
+                    return nextWordIndex * kBitsPerWord + std::countr_zero(_words[nextWordIndex]);
+                }
+            }
+            return npos;
+        }
+
+        // Returns the lowest member, the set must not be empty.
+        constexpr TId front() const noexcept
+        {
+            return *begin();
+        }
+
+        constexpr const_iterator begin() const noexcept
+        {
+            return const_iterator(this, FindNext(0));
+        }
+
+        constexpr const_iterator end() const noexcept
+        {
+            return const_iterator(this, npos);
+        }
+    };
+} // namespace OpenRCT2
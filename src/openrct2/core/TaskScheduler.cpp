@@ -0,0 +1,238 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TaskScheduler.h"
+
+#include <cassert>
+#include <chrono>
+
+namespace OpenRCT2
+{
+    static constexpr size_t kInitialQueueCapacity = 256;
+    static constexpr auto kReportInterval = std::chrono::milliseconds(16);
+
+    // Identifies the worker queue of the current thread so tasks spawned by tasks stay local.
+    static thread_local const TaskScheduler* _currentScheduler = nullptr;
+    static thread_local size_t _currentWorker = 0;
+
+    TaskGroup::TaskGroup(TaskScheduler& scheduler)
+        : _scheduler(scheduler)
+    {
+    }
+
+    TaskGroup::~TaskGroup()
+    {
+        Wait();
+    }
+
+    void TaskGroup::Wait(const std::function<void()>& reportFn)
+    {
+        while (_numPending.load(std::memory_order_acquire) != 0)
+        {
+            // Help out rather than block while there is work queued.
+            TaskScheduler::Task task;
+            if (_scheduler.TryPop(task))
+            {
+                _scheduler.Execute(task);
+                continue;
+            }
+
+            auto isDone = [this]() { return _numPending.load(std::memory_order_acquire) == 0; };
+            std::unique_lock lock(_scheduler._doneMutex);
+            if (reportFn != nullptr)
+            {
+                _scheduler._condDone.wait_for(lock, kReportInterval, isDone);
+                lock.unlock();
+                reportFn();
+            }
+            else
+            {
+                _scheduler._condDone.wait(lock, isDone);
+            }
+        }
+    }
+
+    void TaskScheduler::WorkerQueue::PushBack(const Task& task)
+    {
+        if (Count == Tasks.size())
+        {
+            // Grow the ring buffer, unwrapping the existing tasks.
+            std::vector<Task> tasks(std::max(kInitialQueueCapacity, Tasks.size() * 2));
+            for (size_t i = 0; i < Count; i++)
+            {
+                tasks[i] = Tasks[(Head + i) % Tasks.size()];
+            }
+            Tasks = std::move(tasks);
+            Head = 0;
+        }
+        Tasks[(Head + Count) % Tasks.size()] = task;
+        Count++;
+    }
+
+    bool TaskScheduler::WorkerQueue::PopBack(Task& task)
+    {
+        if (Count == 0)
+            return false;
+
+        Count--;
+        task = Tasks[(Head + Count) % Tasks.size()];
+        return true;
+    }
+
+    bool TaskScheduler::WorkerQueue::PopFront(Task& task)
+    {
+        if (Count == 0)
+            return false;
+
+        task = Tasks[Head];
+        Head = (Head + 1) % Tasks.size();
+        Count--;
+        return true;
+    }
+
+    TaskScheduler::TaskScheduler(size_t maxThreads)
+    {
+        const auto numThreads = std::max<size_t>(std::min<size_t>(maxThreads, std::thread::hardware_concurrency()), 1);
+        for (size_t i = 0; i < numThreads; i++)
+        {
+            _queues.push_back(std::make_unique<WorkerQueue>());
+        }
+        for (size_t i = 0; i < numThreads; i++)
+        {
+            _threads.emplace_back(&TaskScheduler::WorkerMain, this, i);
+        }
+    }
+
+    TaskScheduler::~TaskScheduler()
+    {
+        {
+            std::lock_guard lock(_sleepMutex);
+            _shouldStop = true;
+        }
+        _condWork.notify_all();
+
+        for (auto& th : _threads)
+        {
+            assert(th.joinable() != false);
+            th.join();
+        }
+    }
+
+    TaskScheduler& TaskScheduler::GetShared()
+    {
+        static TaskScheduler scheduler;
+        return scheduler;
+    }
+
+    size_t TaskScheduler::GetNumThreads() const
+    {
+        return _threads.size();
+    }
+
+    void TaskScheduler::Push(const Task& task)
+    {
+        size_t queueIndex;
+        if (_currentScheduler == this)
+        {
+            queueIndex = _currentWorker;
+        }
+        else
+        {
+            queueIndex = _nextQueue.fetch_add(1, std::memory_order_relaxed) % _queues.size();
+        }
+
+        // Counted before the task becomes visible so the counter never drops below the number of queued tasks.
+        const auto numQueuedBefore = _numQueued.fetch_add(1);
+        {
+            auto& queue = *_queues[queueIndex];
+            std::lock_guard lock(queue.Mutex);
+            queue.PushBack(task);
+        }
+
+        // Workers register as sleeping before checking for queued tasks, so one side always sees the other.
+        // Sleeping workers have already been woken for the tasks queued before this one.
+        if (numQueuedBefore < _numSleeping.load())
+        {
+            {
+                std::lock_guard lock(_sleepMutex);
+            }
+            _condWork.notify_one();
+        }
+    }
+
+    bool TaskScheduler::TryPop(Task& task)
+    {
+        if (_numQueued.load(std::memory_order_relaxed) == 0)
+            return false;
+
+        const auto numQueues = _queues.size();
+        const auto isWorker = _currentScheduler == this;
+        const auto first = isWorker ? _currentWorker : 0;
+
+        // Own queue in LIFO order for locality, others are stolen from in FIFO order.
+        if (isWorker)
+        {
+            auto& queue = *_queues[first];
+            std::lock_guard lock(queue.Mutex);
+            if (queue.PopBack(task))
+            {
+                _numQueued.fetch_sub(1);
+                return true;
+            }
+        }
+        for (size_t i = isWorker ? 1 : 0; i < numQueues; i++)
+        {
+            auto& queue = *_queues[(first + i) % numQueues];
+            std::lock_guard lock(queue.Mutex);
+            if (queue.PopFront(task))
+            {
+                _numQueued.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void TaskScheduler::Execute(const Task& task)
+    {
+        task.Invoke();
+
+        auto* group = task.GetGroup();
+        if (group->_numPending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            {
+                std::lock_guard lock(_doneMutex);
+            }
+            _condDone.notify_all();
+        }
+    }
+
+    void TaskScheduler::WorkerMain(size_t index)
+    {
+        _currentScheduler = this;
+        _currentWorker = index;
+
+        while (true)
+        {
+            Task task;
+            if (TryPop(task))
+            {
+                Execute(task);
+                continue;
+            }
+
+            std::unique_lock lock(_sleepMutex);
+            _numSleeping.fetch_add(1);
+            _condWork.wait(lock, [this]() { return _shouldStop || _numQueued.load() != 0; });
+            _numSleeping.fetch_sub(1);
+            if (_shouldStop && _numQueued.load() == 0)
+                break;
+        }
+    }
+} // namespace OpenRCT2
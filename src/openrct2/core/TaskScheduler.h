@@ -0,0 +1,164 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace OpenRCT2
+{
+    class TaskScheduler;
+
+    /**
+     * A set of tasks that can be waited on together. The waiting thread executes queued tasks itself
+     * until all tasks of the group have finished, so groups may be nested inside tasks.
+     */
+    class TaskGroup
+    {
+        friend class TaskScheduler;
+
+        TaskScheduler& _scheduler;
+        std::atomic<size_t> _numPending{};
+
+    public:
+        explicit TaskGroup(TaskScheduler& scheduler);
+        ~TaskGroup();
+
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        template<typename TFn>
+        void Run(const TFn& fn);
+
+        // reportFn is called on the waiting thread periodically until the group has finished.
+        void Wait(const std::function<void()>& reportFn = nullptr);
+    };
+
+    /**
+     * Work stealing thread pool. Every worker owns a queue, tasks added from a worker go to its own
+     * queue and idle workers steal from the others. Tasks are stored inline without any allocation,
+     * which requires them to be small and trivially copyable, e.g. lambdas capturing pointers.
+     */
+    class TaskScheduler
+    {
+        friend class TaskGroup;
+
+    public:
+        class Task
+        {
+        public:
+            static constexpr size_t kStorageSize = 48;
+
+        private:
+            alignas(std::max_align_t) std::byte _storage[kStorageSize]{};
+            void (*_invoke)(const std::byte*){};
+            TaskGroup* _group{};
+
+        public:
+            Task() = default;
+
+            template<typename TFn>
+            Task(const TFn& fn, TaskGroup* group)
+                : _group(group)
+            {
+                static_assert(std::is_trivially_copyable_v<TFn>, "Task functions must be trivially copyable");
+                static_assert(sizeof(TFn) <= kStorageSize, "Task function captures too much");
+                static_assert(alignof(TFn) <= alignof(std::max_align_t));
+
+                new (_storage) TFn(fn);
+                _invoke = [](const std::byte* storage) { (*std::launder(reinterpret_cast<const TFn*>(storage)))(); };
+            }
+
+            void Invoke() const
+            {
+                _invoke(_storage);
+            }
+
+            TaskGroup* GetGroup() const
+            {
+                return _group;
+            }
+        };
+
+    private:
+        struct WorkerQueue
+        {
+            std::mutex Mutex;
+            std::vector<Task> Tasks;
+            size_t Head{};
+            size_t Count{};
+
+            void PushBack(const Task& task);
+            bool PopBack(Task& task);
+            bool PopFront(Task& task);
+        };
+
+        std::vector<std::unique_ptr<WorkerQueue>> _queues;
+        std::vector<std::thread> _threads;
+        std::atomic<size_t> _numQueued{};
+        std::atomic<size_t> _numSleeping{};
+        std::atomic<size_t> _nextQueue{};
+        std::atomic<bool> _shouldStop{};
+        std::mutex _sleepMutex;
+        std::condition_variable _condWork;
+        std::mutex _doneMutex;
+        std::condition_variable _condDone;
+
+    public:
+        explicit TaskScheduler(size_t maxThreads = 255);
+        ~TaskScheduler();
+
+        // The pool shared by the whole process, created on first use with a worker per hardware thread. Paint,
+        // compression and object loading all run on it so they do not start competing pools of their own.
+        static TaskScheduler& GetShared();
+
+        size_t GetNumThreads() const;
+
+        /**
+         * Splits [begin, end) into ranges of at most grainSize elements and calls fn(first, last) for
+         * each of them in parallel, returns once all ranges are done.
+         */
+        template<typename TFn>
+        void ParallelFor(size_t begin, size_t end, size_t grainSize, const TFn& fn)
+        {
+            TaskGroup group(*this);
+            grainSize = std::max<size_t>(grainSize, 1);
+            for (size_t first = begin; first < end; first += grainSize)
+            {
+                const auto last = std::min(first + grainSize, end);
+                auto* fnPtr = &fn;
+                group.Run([fnPtr, first, last]() { (*fnPtr)(first, last); });
+            }
+            group.Wait();
+        }
+
+    private:
+        void Push(const Task& task);
+        bool TryPop(Task& task);
+        void Execute(const Task& task);
+        void WorkerMain(size_t index);
+    };
+
+    template<typename TFn>
+    void TaskGroup::Run(const TFn& fn)
+    {
+        _numPending.fetch_add(1, std::memory_order_relaxed);
+        _scheduler.Push(TaskScheduler::Task(fn, this));
+    }
+} // namespace OpenRCT2
@@ -41,6 +41,82 @@ void MaskAvx2(
     }
 }
 
+// Same as the SSE 4.1 lookup, with each row of the table in both lanes so 32 indices are looked up at once.
+static __m256i Lookup(const __m256i (&table)[16], __m256i index)
+{
+    const __m256i bias = _mm256_set1_epi8(0x70);
+    const __m256i rowSize = _mm256_set1_epi8(16);
+    __m256i result = _mm256_shuffle_epi8(table[0], _mm256_adds_epu8(index, bias));
+    for (int32_t row = 1; row < 16; row++)
+    {
+        index = _mm256_sub_epi8(index, rowSize);
+        result = _mm256_or_si256(result, _mm256_shuffle_epi8(table[row], _mm256_adds_epu8(index, bias)));
+    }
+    return result;
+}
+
+static void LoadTable(__m256i (&table)[16], const uint8_t* paletteMap)
+{
+    for (int32_t row = 0; row < 16; row++)
+    {
+        table[row] = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(paletteMap + row * 16)));
+    }
+}
+
+void CopyTransparentRowAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count)
+{
+    const __m256i zero = {};
+    int32_t x = 0;
+    for (; x + 32 <= count; x += 32)
+    {
+        const __m256i colour = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + x));
+        const __m256i dest = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + x));
+        const __m256i blended = _mm256_blendv_epi8(colour, dest, _mm256_cmpeq_epi8(colour, zero));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + x), blended);
+    }
+    CopyTransparentRowSse4_1(src + x, dst + x, count - x);
+}
+
+void RemapSrcRowAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT paletteMap)
+{
+    int32_t x = 0;
+    if (count >= 32)
+    {
+        __m256i table[16];
+        LoadTable(table, paletteMap);
+        const __m256i zero = {};
+        for (; x + 32 <= count; x += 32)
+        {
+            const __m256i colour = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + x));
+            const __m256i dest = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + x));
+            const __m256i remapped = Lookup(table, colour);
+            const __m256i skip = _mm256_or_si256(_mm256_cmpeq_epi8(colour, zero), _mm256_cmpeq_epi8(remapped, zero));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + x), _mm256_blendv_epi8(remapped, dest, skip));
+        }
+    }
+    RemapSrcRowSse4_1(src + x, dst + x, count - x, paletteMap);
+}
+
+void RemapDstRowAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT paletteMap)
+{
+    int32_t x = 0;
+    if (count >= 32)
+    {
+        __m256i table[16];
+        LoadTable(table, paletteMap);
+        const __m256i zero = {};
+        for (; x + 32 <= count; x += 32)
+        {
+            const __m256i colour = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + x));
+            const __m256i dest = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + x));
+            const __m256i remapped = Lookup(table, dest);
+            const __m256i skip = _mm256_or_si256(_mm256_cmpeq_epi8(colour, zero), _mm256_cmpeq_epi8(remapped, zero));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + x), _mm256_blendv_epi8(remapped, dest, skip));
+        }
+    }
+    RemapDstRowSse4_1(src + x, dst + x, count - x, paletteMap);
+}
+
 #else
 
     #ifdef OPENRCT2_X86
@@ -54,4 +130,19 @@ void MaskAvx2(
     OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
 }
 
+void CopyTransparentRowAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count)
+{
+    OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void RemapSrcRowAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT paletteMap)
+{
+    OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void RemapDstRowAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT paletteMap)
+{
+    OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
 #endif // __AVX2__
@@ -48,6 +48,14 @@ static void FASTCALL DrawBMPSpriteMinify(DrawPixelInfo& dpi, const DrawSpriteArg
     size_t srcLineWidth = zoomLevel.ApplyTo(g1.width);
     size_t dstLineWidth = dpi.LineStride();
     uint8_t zoom = zoomLevel.ApplyTo(1);
+    if (zoom == 1)
+    {
+        for (; height > 0; height--, src += srcLineWidth, dst += dstLineWidth)
+        {
+            BlitRow<TBlendOp>(src, dst, width, paletteMap);
+        }
+        return;
+    }
     for (; height > 0; height -= zoom)
     {
         auto nextSrc = src + srcLineWidth;
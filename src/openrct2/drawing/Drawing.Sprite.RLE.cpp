@@ -137,6 +137,13 @@ static void FASTCALL DrawRLESpriteMinify(DrawPixelInfo& dpi, const DrawSpriteArg
                     std::memcpy(dst, src, numPixels);
                 }
             }
+            else if constexpr (TZoom == 0)
+            {
+                if (numPixels > 0)
+                {
+                    BlitRow<TBlendOp>(src, dst, numPixels, args.PalMap);
+                }
+            }
             else
             {
                 auto& paletteMap = args.PalMap;
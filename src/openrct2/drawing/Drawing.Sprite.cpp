@@ -16,6 +16,7 @@
 #include "../config/Config.h"
 #include "../core/FileStream.h"
 #include "../core/Guard.hpp"
+#include "../core/MemoryMappedFile.h"
 #include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
 #include "../platform/Platform.h"
@@ -411,6 +412,47 @@ void MaskScalar(
     }
 }
 
+void CopyTransparentRowScalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count)
+{
+    for (int32_t x = 0; x < count; x++)
+    {
+        if (src[x] != 0)
+        {
+            dst[x] = src[x];
+        }
+    }
+}
+
+void RemapSrcRowScalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT paletteMap)
+{
+    for (int32_t x = 0; x < count; x++)
+    {
+        if (src[x] != 0)
+        {
+            const uint8_t colour = paletteMap[src[x]];
+            if (colour != 0)
+            {
+                dst[x] = colour;
+            }
+        }
+    }
+}
+
+void RemapDstRowScalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT paletteMap)
+{
+    for (int32_t x = 0; x < count; x++)
+    {
+        if (src[x] != 0)
+        {
+            const uint8_t colour = paletteMap[dst[x]];
+            if (colour != 0)
+            {
+                dst[x] = colour;
+            }
+        }
+    }
+}
+
 static void MaskMagnify(
     const ZoomLevel zoom, int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc,
     uint8_t* RESTRICT dst, int32_t maskStride, int32_t colourStride, int32_t dstStride, int32_t srcX, int32_t srcY)
@@ -438,10 +480,39 @@ static Gx _csg = {};
 static G1Element _scrollingText[kMaxScrollingTextEntries]{};
 static bool _csgLoaded = false;
 
+// The files the elements point into when the sprite data is mapped rather than read.
+static std::unique_ptr<MemoryMappedFile> _g1File;
+static std::unique_ptr<MemoryMappedFile> _g2File;
+static std::unique_ptr<MemoryMappedFile> _csgFile;
+
 static G1Element _g1Temp = {};
 static std::vector<G1Element> _imageListElements;
 bool gTinyFontAntiAliased = false;
 
+/**
+ * Reads the sprite data that follows the element headers in the stream, or maps the file when enabled so the
+ * data is only paged in as sprites are drawn and is shared with other processes using the same file.
+ */
+static uint8_t* LoadGxData(Gx& gx, IStream& stream, u8string_view path, std::unique_ptr<MemoryMappedFile>& mappedFile)
+{
+    if (!Config::Get().general.MapSpriteFiles)
+    {
+        gx.data = stream.ReadArray<uint8_t>(gx.header.total_size);
+        return gx.data.get();
+    }
+
+    const auto dataOffset = stream.GetPosition();
+    mappedFile = std::make_unique<MemoryMappedFile>(path);
+    if (mappedFile->GetSize() < dataOffset + gx.header.total_size)
+    {
+        mappedFile.reset();
+        throw IOException("Attempted to read past end of file.");
+    }
+
+    // The mapping is read-only, the sprite data of the base graphics is never written to.
+    return const_cast<uint8_t*>(mappedFile->GetData() + dataOffset);
+}
+
 /**
  *
  *  rct2: 0x00678998
@@ -469,18 +540,18 @@ bool GfxLoadG1(const IPlatformEnvironment& env)
         gTinyFontAntiAliased = is_rctc;
 
         // Read element data
-        _g1.data = fs.ReadArray<uint8_t>(_g1.header.total_size);
+        auto* data = LoadGxData(_g1, fs, path, _g1File);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _g1.header.num_entries; i++)
         {
             if (_g1.elements[i].offset == nullptr)
             {
-                _g1.elements[i].offset = _g1.data.get();
+                _g1.elements[i].offset = data;
             }
             else
             {
-                _g1.elements[i].offset += reinterpret_cast<uintptr_t>(_g1.data.get());
+                _g1.elements[i].offset += reinterpret_cast<uintptr_t>(data);
             }
             OverrideElementOffsets(i, _g1.elements[i]);
         }
@@ -506,6 +577,7 @@ void GfxUnloadG1()
     _g1.data.reset();
     _g1.elements.clear();
     _g1.elements.shrink_to_fit();
+    _g1File.reset();
 }
 
 void GfxUnloadG2()
@@ -513,6 +585,7 @@ void GfxUnloadG2()
     _g2.data.reset();
     _g2.elements.clear();
     _g2.elements.shrink_to_fit();
+    _g2File.reset();
 }
 
 void GfxUnloadCsg()
@@ -520,6 +593,7 @@ void GfxUnloadCsg()
     _csg.data.reset();
     _csg.elements.clear();
     _csg.elements.shrink_to_fit();
+    _csgFile.reset();
 }
 
 bool GfxLoadG2()
@@ -540,7 +614,7 @@ bool GfxLoadG2()
         ReadAndConvertGxDat(&fs, _g2.header.num_entries, false, _g2.elements.data());
 
         // Read element data
-        _g2.data = fs.ReadArray<uint8_t>(_g2.header.total_size);
+        auto* data = LoadGxData(_g2, fs, path, _g2File);
 
         if (_g2.header.num_entries != G2_SPRITE_COUNT)
         {
@@ -563,11 +637,11 @@ bool GfxLoadG2()
         {
             if (_g2.elements[i].offset == nullptr)
             {
-                _g2.elements[i].offset = _g2.data.get();
+                _g2.elements[i].offset = data;
             }
             else
             {
-                _g2.elements[i].offset += reinterpret_cast<uintptr_t>(_g2.data.get());
+                _g2.elements[i].offset += reinterpret_cast<uintptr_t>(data);
             }
         }
         return true;
@@ -620,18 +694,18 @@ bool GfxLoadCsg()
         ReadAndConvertGxDat(&fileHeader, _csg.header.num_entries, false, _csg.elements.data());
 
         // Read element data
-        _csg.data = fileData.ReadArray<uint8_t>(_csg.header.total_size);
+        auto* data = LoadGxData(_csg, fileData, pathDataPath, _csgFile);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _csg.header.num_entries; i++)
         {
             if (_csg.elements[i].offset == nullptr)
             {
-                _csg.elements[i].offset = _csg.data.get();
+                _csg.elements[i].offset = data;
             }
             else
             {
-                _csg.elements[i].offset += reinterpret_cast<uintptr_t>(_csg.data.get());
+                _csg.elements[i].offset += reinterpret_cast<uintptr_t>(data);
             }
             // RCT1 used zoomed offsets that counted from the beginning of the file, rather than from the current sprite.
             if (_csg.elements[i].flags & G1_FLAG_HAS_ZOOM_SPRITE)
@@ -19,6 +19,7 @@
 #include "../object/Object.h"
 #include "../object/ObjectEntryManager.h"
 #include "../object/WaterEntry.h"
+#include "../paint/PaintCache.h"
 #include "../platform/Platform.h"
 #include "../sprites.h"
 #include "../util/Util.h"
@@ -66,6 +67,11 @@ uint8_t PaletteMap::Blend(uint8_t src, uint8_t dst) const
     return _data[idx];
 }
 
+std::span<const uint8_t> PaletteMap::Data() const
+{
+    return _data;
+}
+
 void PaletteMap::Copy(size_t dstIndex, const PaletteMap& src, size_t srcIndex, size_t length)
 {
     auto maxLength = std::min(_data.size() - srcIndex, _data.size() - dstIndex);
@@ -678,6 +684,49 @@ void MaskFn(
     MaskFunc(width, height, maskSrc, colourSrc, dst, maskWrap, colourWrap, dstWrap);
 }
 
+struct RowFunctions
+{
+    void (*CopyTransparent)(const uint8_t* RESTRICT, uint8_t* RESTRICT, int32_t);
+    void (*RemapSrc)(const uint8_t* RESTRICT, uint8_t* RESTRICT, int32_t, const uint8_t* RESTRICT);
+    void (*RemapDst)(const uint8_t* RESTRICT, uint8_t* RESTRICT, int32_t, const uint8_t* RESTRICT);
+};
+
+static RowFunctions GetRowFunctions()
+{
+    if (Platform::AVX2Available())
+    {
+        LOG_VERBOSE("registering AVX2 row functions");
+        return { CopyTransparentRowAvx2, RemapSrcRowAvx2, RemapDstRowAvx2 };
+    }
+    else if (Platform::SSE41Available())
+    {
+        LOG_VERBOSE("registering SSE4.1 row functions");
+        return { CopyTransparentRowSse4_1, RemapSrcRowSse4_1, RemapDstRowSse4_1 };
+    }
+    else
+    {
+        LOG_VERBOSE("registering scalar row functions");
+        return { CopyTransparentRowScalar, RemapSrcRowScalar, RemapDstRowScalar };
+    }
+}
+
+static const auto RowFuncs = GetRowFunctions();
+
+void CopyTransparentRowFn(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count)
+{
+    RowFuncs.CopyTransparent(src, dst, count);
+}
+
+void RemapSrcRowFn(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT paletteMap)
+{
+    RowFuncs.RemapSrc(src, dst, count, paletteMap);
+}
+
+void RemapDstRowFn(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT paletteMap)
+{
+    RowFuncs.RemapDst(src, dst, count, paletteMap);
+}
+
 void GfxFilterPixel(DrawPixelInfo& dpi, const ScreenCoordsXY& coords, FilterPaletteID palette)
 {
     GfxFilterRect(dpi, { coords, coords }, palette);
@@ -758,6 +807,7 @@ void LoadPalette()
  */
 void GfxInvalidateScreen()
 {
+    OpenRCT2::PaintCache::Invalidate();
     GfxSetDirtyBlocks({ { 0, 0 }, { ContextGetWidth(), ContextGetHeight() } });
 }
 
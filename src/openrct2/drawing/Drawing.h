@@ -385,6 +385,7 @@ public:
     uint8_t operator[](size_t index) const;
 
     uint8_t Blend(uint8_t src, uint8_t dst) const;
+    std::span<const uint8_t> Data() const;
     void Copy(size_t dstIndex, const PaletteMap& src, size_t srcIndex, size_t length);
 };
 
@@ -603,6 +604,52 @@ void MaskFn(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
 
+// Row blitters for sprites drawn at zoom level 0, each leaves the pixels that BlitPixel would skip unchanged.
+// CopyTransparentRow copies the non zero pixels, RemapSrcRow draws the non zero pixels through the 256 entry paletteMap
+// and RemapDstRow draws the pixels under the non zero pixels through it.
+void CopyTransparentRowScalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count);
+void CopyTransparentRowSse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count);
+void CopyTransparentRowAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count);
+void RemapSrcRowScalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT paletteMap);
+void RemapSrcRowSse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT paletteMap);
+void RemapSrcRowAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT paletteMap);
+void RemapDstRowScalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT paletteMap);
+void RemapDstRowSse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT paletteMap);
+void RemapDstRowAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT paletteMap);
+
+void CopyTransparentRowFn(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count);
+void RemapSrcRowFn(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT paletteMap);
+void RemapDstRowFn(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT paletteMap);
+
+// Same as calling BlitPixel for each pixel of the row, using the row blitters where there is one for the blend operation.
+template<DrawBlendOp TBlendOp>
+void FASTCALL BlitRow(const uint8_t* src, uint8_t* dst, int32_t count, const PaletteMap& paletteMap)
+{
+    if constexpr (TBlendOp == kBlendTransparent)
+    {
+        CopyTransparentRowFn(src, dst, count);
+        return;
+    }
+    else if constexpr (TBlendOp == (kBlendTransparent | kBlendSrc) || TBlendOp == (kBlendTransparent | kBlendDst))
+    {
+        // Maps for fewer colours, such as the ones of text, are looked up one pixel at a time.
+        const auto table = paletteMap.Data();
+        if (table.size() >= 256)
+        {
+            if constexpr (TBlendOp & kBlendSrc)
+                RemapSrcRowFn(src, dst, count, table.data());
+            else
+                RemapDstRowFn(src, dst, count, table.data());
+            return;
+        }
+    }
+
+    for (int32_t x = 0; x < count; x++)
+    {
+        BlitPixel<TBlendOp>(src + x, dst + x, paletteMap);
+    }
+}
+
 std::optional<uint32_t> GetPaletteG1Index(colour_t paletteId);
 std::optional<PaletteMap> GetPaletteMapForColour(colour_t paletteId);
 void UpdatePalette(std::span<const OpenRCT2::Drawing::PaletteBGRA> palette, int32_t start_index, int32_t num_colours);
@@ -55,6 +55,83 @@ void MaskSse4_1(
     }
 }
 
+// Looks up 16 indices in a 256 entry table held as 16 rows of 16 entries. Each shuffle only keeps the indices that fall
+// in its row, the others are pushed to 0x80 or above by the saturating add so the shuffle zeroes them.
+static __m128i Lookup(const __m128i (&table)[16], __m128i index)
+{
+    const __m128i bias = _mm_set1_epi8(0x70);
+    const __m128i rowSize = _mm_set1_epi8(16);
+    __m128i result = _mm_shuffle_epi8(table[0], _mm_adds_epu8(index, bias));
+    for (int32_t row = 1; row < 16; row++)
+    {
+        index = _mm_sub_epi8(index, rowSize);
+        result = _mm_or_si128(result, _mm_shuffle_epi8(table[row], _mm_adds_epu8(index, bias)));
+    }
+    return result;
+}
+
+static void LoadTable(__m128i (&table)[16], const uint8_t* paletteMap)
+{
+    for (int32_t row = 0; row < 16; row++)
+    {
+        table[row] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(paletteMap + row * 16));
+    }
+}
+
+void CopyTransparentRowSse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count)
+{
+    const __m128i zero = {};
+    int32_t x = 0;
+    for (; x + 16 <= count; x += 16)
+    {
+        const __m128i colour = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+        const __m128i dest = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + x));
+        const __m128i blended = _mm_blendv_epi8(colour, dest, _mm_cmpeq_epi8(colour, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), blended);
+    }
+    CopyTransparentRowScalar(src + x, dst + x, count - x);
+}
+
+void RemapSrcRowSse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT paletteMap)
+{
+    int32_t x = 0;
+    if (count >= 16)
+    {
+        __m128i table[16];
+        LoadTable(table, paletteMap);
+        const __m128i zero = {};
+        for (; x + 16 <= count; x += 16)
+        {
+            const __m128i colour = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+            const __m128i dest = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + x));
+            const __m128i remapped = Lookup(table, colour);
+            const __m128i skip = _mm_or_si128(_mm_cmpeq_epi8(colour, zero), _mm_cmpeq_epi8(remapped, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), _mm_blendv_epi8(remapped, dest, skip));
+        }
+    }
+    RemapSrcRowScalar(src + x, dst + x, count - x, paletteMap);
+}
+
+void RemapDstRowSse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT paletteMap)
+{
+    int32_t x = 0;
+    if (count >= 16)
+    {
+        __m128i table[16];
+        LoadTable(table, paletteMap);
+        const __m128i zero = {};
+        for (; x + 16 <= count; x += 16)
+        {
+            const __m128i colour = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+            const __m128i dest = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + x));
+            const __m128i remapped = Lookup(table, dest);
+            const __m128i skip = _mm_or_si128(_mm_cmpeq_epi8(colour, zero), _mm_cmpeq_epi8(remapped, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), _mm_blendv_epi8(remapped, dest, skip));
+        }
+    }
+    RemapDstRowScalar(src + x, dst + x, count - x, paletteMap);
+}
+
 #else
 
     #ifdef OPENRCT2_X86
@@ -68,4 +145,19 @@ void MaskSse4_1(
     OpenRCT2::Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
 }
 
+void CopyTransparentRowSse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count)
+{
+    OpenRCT2::Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
+void RemapSrcRowSse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT paletteMap)
+{
+    OpenRCT2::Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
+void RemapDstRowSse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, const uint8_t* RESTRICT paletteMap)
+{
+    OpenRCT2::Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
 #endif // __SSE4_1__
@@ -14,10 +14,9 @@
 #include "EntityBase.h"
 #include "EntityRegistry.h"
 
-#include <list>
 #include <vector>
 
-const std::list<EntityId>& GetEntityList(const EntityType id);
+const EntityIdSet& GetEntityList(const EntityType id);
 
 uint16_t GetEntityListCount(EntityType list);
 uint16_t GetMiscEntityCount();
@@ -102,12 +101,12 @@ template<typename T>
 class EntityListIterator
 {
 private:
-    std::list<EntityId>::const_iterator iter;
-    std::list<EntityId>::const_iterator end;
+    EntityIdSet::const_iterator iter;
+    EntityIdSet::const_iterator end;
     T* Entity = nullptr;
 
 public:
-    EntityListIterator(std::list<EntityId>::const_iterator _iter, std::list<EntityId>::const_iterator _end)
+    EntityListIterator(EntityIdSet::const_iterator _iter, EntityIdSet::const_iterator _end)
         : iter(_iter)
         , end(_end)
     {
@@ -155,7 +154,7 @@ class EntityList
 {
 private:
     using EntityListIterator_t = EntityListIterator<T>;
-    const std::list<EntityId>& vec;
+    const EntityIdSet& vec;
 
 public:
     EntityList()
@@ -12,6 +12,7 @@
 #include "../Diagnostic.h"
 #include "../Game.h"
 #include "../GameState.h"
+#include "../config/Config.h"
 #include "../core/Algorithm.hpp"
 #include "../core/ChecksumStream.h"
 #include "../core/Crypt.h"
@@ -28,21 +29,24 @@
 #include "../scenario/Scenario.h"
 #include "Balloon.h"
 #include "Duck.h"
+#include "EntitySpatialIndex.h"
 #include "EntityTweener.h"
 #include "Fountain.h"
+#include "GuestHotState.h"
 #include "MoneyEffect.h"
 #include "Particle.h"
 
 #include <cassert>
 #include <cmath>
+#include <cstring>
 #include <iterator>
 #include <numeric>
 #include <vector>
 
 using namespace OpenRCT2;
 
-static std::array<std::list<EntityId>, EnumValue(EntityType::Count)> gEntityLists;
-static std::vector<EntityId> _freeIdList;
+static std::array<EntityIdSet, EnumValue(EntityType::Count)> gEntityLists;
+static EntityIdSet _freeIdList;
 
 static bool _entityFlashingList[kMaxEntities];
 
@@ -52,7 +56,7 @@ static constexpr uint32_t kSpatialIndexNullBucket = kSpatialIndexSize - 1;
 static constexpr uint32_t kInvalidSpatialIndex = 0xFFFFFFFFu;
 static constexpr uint32_t kSpatialIndexDirtyMask = 1u << 31;
 
-static std::array<std::vector<EntityId>, kSpatialIndexSize> gEntitySpatialIndex;
+static EntitySpatialIndex gEntitySpatialIndex;
 
 static void FreeEntity(EntityBase& entity);
 
@@ -114,7 +118,16 @@ EntityBase* TryGetEntity(EntityId entityIndex)
 {
     auto& gameState = GetGameState();
     const auto idx = entityIndex.ToUnderlying();
-    return idx >= kMaxEntities ? nullptr : &gameState.Entities[idx].base;
+    if (idx >= kMaxEntities)
+        return nullptr;
+
+    auto* entity = &gameState.Entities[idx].base;
+    // Guests in the hot state mirror must be synchronised before anything else can access them.
+    if (Config::Get().general.GuestHotStateMirror && GuestHotState::IsArmed(entityIndex))
+    {
+        GuestHotState::Flush(*reinterpret_cast<Guest*>(entity));
+    }
+    return entity;
 }
 
 EntityBase* GetEntity(EntityId entityIndex)
@@ -129,7 +142,7 @@ EntityBase* GetEntity(EntityId entityIndex)
 
 const std::vector<EntityId>& GetEntityTileList(const CoordsXY& spritePos)
 {
-    return gEntitySpatialIndex[ComputeSpatialIndex(spritePos)];
+    return gEntitySpatialIndex.Get(ComputeSpatialIndex(spritePos));
 }
 
 static void ResetEntityLists()
@@ -142,18 +155,10 @@ static void ResetEntityLists()
 
 static void ResetFreeIds()
 {
-    _freeIdList.clear();
-    _freeIdList.resize(kMaxEntities);
-
-    // List needs to be back to front to simplify removing
-    auto nextId = 0;
-    std::for_each(std::rbegin(_freeIdList), std::rend(_freeIdList), [&](auto& elem) {
-        elem = EntityId::FromUnderlying(nextId);
-        nextId++;
-    });
+    _freeIdList.fill();
 }
 
-const std::list<EntityId>& GetEntityList(const EntityType id)
+const EntityIdSet& GetEntityList(const EntityType id)
 {
     return gEntityLists[EnumValue(id)];
 }
@@ -176,6 +181,7 @@ void ResetAllEntities()
     }
 
     auto& gameState = GetGameState();
+    GuestHotState::Clear();
     std::fill(std::begin(gameState.Entities), std::end(gameState.Entities), Entity_t());
     OpenRCT2::RideUse::GetHistory().Clear();
     OpenRCT2::RideUse::GetTypeHistory().Clear();
@@ -194,6 +200,7 @@ void ResetAllEntities()
     ResetEntityLists();
     ResetFreeIds();
     ResetEntitySpatialIndices();
+    ResetEntityChecksumCache();
 }
 
 static void EntitySpatialInsert(EntityBase* entity, const CoordsXY& newLoc);
@@ -206,10 +213,7 @@ static void EntitySpatialInsert(EntityBase* entity, const CoordsXY& newLoc);
  */
 void ResetEntitySpatialIndices()
 {
-    for (auto& vec : gEntitySpatialIndex)
-    {
-        vec.clear();
-    }
+    gEntitySpatialIndex.Clear();
     for (EntityId::UnderlyingType i = 0; i < kMaxEntities; i++)
     {
         auto* entity = GetEntity(EntityId::FromUnderlying(i));
@@ -247,6 +251,93 @@ EntitiesChecksum GetAllEntitiesChecksum()
 
     return checksum;
 }
+
+struct EntityChecksumCache
+{
+    // Raw bytes of the entity when its hash was taken, serialising it again would give the same bytes.
+    Entity_t Shadow;
+    uint64_t Hash{};
+    bool IsValid{};
+};
+
+static std::vector<EntityChecksumCache> _entityChecksumCache;
+
+template<typename T>
+static uint64_t GetEntityHash(T& entity)
+{
+    EntitiesChecksum checksum{};
+
+    OpenRCT2::ChecksumStream ms(checksum.raw);
+    DataSerialiser ds(true, ms);
+    entity.Serialise(ds);
+
+    uint64_t hash;
+    std::memcpy(&hash, checksum.raw.data(), sizeof(hash));
+    return hash;
+}
+
+// Scrambles the hash of an entity before it is added to the others, so the sum does not depend on the order
+// of the entities but changes in different entities do not cancel out.
+static uint64_t MixEntityHash(uint64_t hash)
+{
+    hash ^= hash >> 30;
+    hash *= 0xbf58476d1ce4e5b9ULL;
+    hash ^= hash >> 27;
+    hash *= 0x94d049bb133111ebULL;
+    hash ^= hash >> 31;
+    return hash;
+}
+
+template<typename T>
+static void AddEntityTypeHashes(uint64_t& sum, bool verify)
+{
+    for (auto* ent : EntityList<T>())
+    {
+        const auto index = ent->Id.ToUnderlying();
+        if (index >= _entityChecksumCache.size())
+        {
+            _entityChecksumCache.resize(index + 1);
+        }
+
+        auto& cache = _entityChecksumCache[index];
+        if (!cache.IsValid || std::memcmp(static_cast<const void*>(&cache.Shadow), static_cast<const void*>(ent), sizeof(T)) != 0)
+        {
+            cache.Hash = GetEntityHash(*ent);
+            std::memcpy(static_cast<void*>(&cache.Shadow), static_cast<const void*>(ent), sizeof(T));
+            cache.IsValid = true;
+        }
+        else if (verify)
+        {
+            const auto hash = GetEntityHash(*ent);
+            if (hash != cache.Hash)
+            {
+                LOG_ERROR("Cached checksum of entity %u is stale", index);
+                cache.Hash = hash;
+            }
+        }
+        sum += MixEntityHash(cache.Hash);
+    }
+}
+
+void ResetEntityChecksumCache()
+{
+    _entityChecksumCache.clear();
+}
+
+EntitiesChecksum GetAllEntitiesIncrementalChecksum()
+{
+    const bool verify = Config::Get().general.VerifyEntityChecksums;
+
+    uint64_t sum = 0;
+    AddEntityTypeHashes<Guest>(sum, verify);
+    AddEntityTypeHashes<Staff>(sum, verify);
+    AddEntityTypeHashes<Vehicle>(sum, verify);
+    AddEntityTypeHashes<Litter>(sum, verify);
+
+    EntitiesChecksum checksum{};
+    std::memcpy(checksum.raw.data(), &sum, sizeof(sum));
+    return checksum;
+}
 #else
 
 EntitiesChecksum GetAllEntitiesChecksum()
@@ -254,6 +345,15 @@ EntitiesChecksum GetAllEntitiesChecksum()
     return EntitiesChecksum{};
 }
 
+EntitiesChecksum GetAllEntitiesIncrementalChecksum()
+{
+    return EntitiesChecksum{};
+}
+
+void ResetEntityChecksumCache()
+{
+}
+
 #endif // DISABLE_NETWORK
 
 static void EntityReset(EntityBase* entity)
@@ -273,25 +373,19 @@ static constexpr uint16_t kMaxMiscEntities = 1600;
 
 static void AddToEntityList(EntityBase* entity)
 {
-    auto& list = gEntityLists[EnumValue(entity->Type)];
-    // Entity list must be in sprite_index order to prevent desync issues
-    list.insert(std::lower_bound(std::begin(list), std::end(list), entity->Id), entity->Id);
+    // Entity lists are iterated in sprite_index order which prevents desync issues
+    gEntityLists[EnumValue(entity->Type)].insert(entity->Id);
 }
 
 static void AddToFreeList(EntityId index)
 {
-    // Free list must be in reverse sprite_index order to prevent desync issues
-    _freeIdList.insert(std::upper_bound(std::rbegin(_freeIdList), std::rend(_freeIdList), index).base(), index);
+    // Free ids are handed out lowest first which prevents desync issues
+    _freeIdList.insert(index);
 }
 
 static void RemoveFromEntityList(EntityBase* entity)
 {
-    auto& list = gEntityLists[EnumValue(entity->Type)];
-    auto ptr = BinaryFind(std::begin(list), std::end(list), entity->Id);
-    if (ptr != std::end(list))
-    {
-        list.erase(ptr);
-    }
+    gEntityLists[EnumValue(entity->Type)].erase(entity->Id);
 }
 
 uint16_t GetMiscEntityCount()
@@ -329,7 +423,7 @@ static void PrepareNewEntity(EntityBase* base, const EntityType type)
 
 EntityBase* CreateEntity(EntityType type)
 {
-    if (_freeIdList.size() == 0)
+    if (_freeIdList.empty())
     {
         // No free sprites.
         return nullptr;
@@ -350,12 +444,13 @@ EntityBase* CreateEntity(EntityType type)
         }
     }
 
-    auto* entity = GetEntity(_freeIdList.back());
+    const auto id = _freeIdList.front();
+    auto* entity = GetEntity(id);
     if (entity == nullptr)
     {
         return nullptr;
     }
-    _freeIdList.pop_back();
+    _freeIdList.erase(id);
 
     PrepareNewEntity(entity, type);
 
@@ -364,8 +459,7 @@ EntityBase* CreateEntity(EntityType type)
 
 EntityBase* CreateEntityAt(const EntityId index, const EntityType type)
 {
-    auto id = BinaryFind(std::rbegin(_freeIdList), std::rend(_freeIdList), index);
-    if (id == std::rend(_freeIdList))
+    if (!_freeIdList.contains(index))
     {
         return nullptr;
     }
@@ -376,7 +470,7 @@ EntityBase* CreateEntityAt(const EntityId index, const EntityType type)
         return nullptr;
     }
 
-    _freeIdList.erase(std::next(id).base());
+    _freeIdList.erase(index);
 
     PrepareNewEntity(entity, type);
     return entity;
@@ -419,25 +513,14 @@ void UpdateMoneyEffect()
 static void EntitySpatialInsert(EntityBase* entity, const CoordsXY& newLoc)
 {
     const auto newIndex = ComputeSpatialIndex(newLoc);
-
-    auto& spatialVector = gEntitySpatialIndex[newIndex];
-    auto index = std::lower_bound(std::begin(spatialVector), std::end(spatialVector), entity->Id);
-    spatialVector.insert(index, entity->Id);
-
+    gEntitySpatialIndex.Insert(newIndex, entity->Id);
     entity->SpatialIndex = newIndex;
 }
 
 static void EntitySpatialRemove(EntityBase* entity)
 {
     const auto currentIndex = GetSpatialIndex(entity);
-
-    auto& spatialVector = gEntitySpatialIndex[currentIndex];
-    auto index = BinaryFind(std::begin(spatialVector), std::end(spatialVector), entity->Id);
-    if (index != std::end(spatialVector))
-    {
-        spatialVector.erase(index, index + 1);
-    }
-    else
+    if (!gEntitySpatialIndex.Remove(currentIndex, entity->Id))
     {
         LOG_WARNING("Bad sprite spatial index. Rebuilding the spatial index...");
         ResetEntitySpatialIndices();
@@ -448,9 +531,14 @@ static void EntitySpatialRemove(EntityBase* entity)
 
 void UpdateEntitiesSpatialIndex()
 {
+    PROFILED_FUNCTION();
+
+    // No tile lists are being iterated at this point, safe to release buckets of empty tiles.
+    gEntitySpatialIndex.Trim();
+
     for (auto& entityList : gEntityLists)
     {
-        for (auto& entityId : entityList)
+        for (auto entityId : entityList)
         {
             auto* entity = GetEntity(entityId);
             if (entity == nullptr || entity->Type == EntityType::Null)
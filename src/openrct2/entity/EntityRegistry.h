@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "../core/OrderedIdSet.hpp"
 #include "EntityBase.h"
 
 #include <array>
@@ -29,6 +30,8 @@ namespace OpenRCT2
 
 constexpr uint16_t kMaxEntities = 65535;
 
+using EntityIdSet = OpenRCT2::OrderedIdSet<EntityId, kMaxEntities>;
+
 EntityBase* GetEntity(EntityId sprite_idx);
 
 template<typename T>
@@ -82,5 +85,10 @@ struct EntitiesChecksum
 #pragma pack(pop)
 EntitiesChecksum GetAllEntitiesChecksum();
 
+// Sum of the checksums of the individual entities, only serialising the entities that changed since the last call.
+EntitiesChecksum GetAllEntitiesIncrementalChecksum();
+// Drops the hashes kept by GetAllEntitiesIncrementalChecksum, so the next call hashes every entity again.
+void ResetEntityChecksumCache();
+
 void EntitySetFlashing(EntityBase* entity, bool flashing);
 bool EntityGetFlashing(EntityBase* entity);
@@ -0,0 +1,155 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "EntitySpatialIndex.h"
+
+#include "../core/Algorithm.hpp"
+
+#include <algorithm>
+#include <bit>
+
+static const std::vector<EntityId> kEmptyBucket;
+
+static constexpr size_t HashKey(uint32_t key, uint32_t shift)
+{
+    // Fibonacci hashing, neighbouring tiles end up far apart.
+    return static_cast<size_t>((key * 0x9E3779B97F4A7C15uLL) >> shift);
+}
+
+EntitySpatialIndex::EntitySpatialIndex()
+{
+    Rehash(kMinCapacity);
+}
+
+size_t EntitySpatialIndex::FindSlot(uint32_t key) const
+{
+    const auto mask = _slots.size() - 1;
+    auto pos = HashKey(key, _hashShift);
+    while (_slots[pos].Key != key && _slots[pos].Key != kEmptyKey)
+    {
+        pos = (pos + 1) & mask;
+    }
+    return pos;
+}
+
+const std::vector<EntityId>& EntitySpatialIndex::Get(uint32_t key) const
+{
+    const auto& slot = _slots[FindSlot(key)];
+    if (slot.Key == kEmptyKey)
+        return kEmptyBucket;
+    return slot.Target->Entities;
+}
+
+std::vector<EntityId>& EntitySpatialIndex::GetOrCreate(uint32_t key)
+{
+    auto pos = FindSlot(key);
+    if (_slots[pos].Key != kEmptyKey)
+        return _slots[pos].Target->Entities;
+
+    // Keep the load factor at or below one quarter so probe sequences for empty tiles stay short.
+    if ((_buckets.size() + 1) * kMaxLoadFactorInverse > _slots.size())
+    {
+        Rehash(_slots.size() * 2);
+        pos = FindSlot(key);
+    }
+
+    auto& bucket = _buckets.emplace_back(Bucket{ key, {} });
+    _slots[pos] = { key, &bucket };
+    _numEmptyBuckets++;
+    return bucket.Entities;
+}
+
+void EntitySpatialIndex::Insert(uint32_t key, EntityId id)
+{
+    auto& entities = GetOrCreate(key);
+    if (entities.empty())
+    {
+        _numEmptyBuckets--;
+    }
+    entities.insert(std::lower_bound(std::begin(entities), std::end(entities), id), id);
+}
+
+bool EntitySpatialIndex::Remove(uint32_t key, EntityId id)
+{
+    const auto& slot = _slots[FindSlot(key)];
+    if (slot.Key == kEmptyKey)
+        return false;
+
+    auto& entities = slot.Target->Entities;
+    auto it = BinaryFind(std::begin(entities), std::end(entities), id);
+    if (it == std::end(entities))
+        return false;
+
+    entities.erase(it);
+    if (entities.empty())
+    {
+        _numEmptyBuckets++;
+    }
+    return true;
+}
+
+void EntitySpatialIndex::Clear()
+{
+    // Buckets are only emptied so references handed out stay valid, Trim releases them later.
+    for (auto& bucket : _buckets)
+    {
+        bucket.Entities.clear();
+    }
+    _numEmptyBuckets = _buckets.size();
+}
+
+void EntitySpatialIndex::Trim()
+{
+    if (_numEmptyBuckets < kMinCapacity || _numEmptyBuckets * 2 < _buckets.size())
+        return;
+
+    std::deque<Bucket> oldBuckets;
+    std::swap(oldBuckets, _buckets);
+    for (auto& bucket : oldBuckets)
+    {
+        if (!bucket.Entities.empty())
+        {
+            _buckets.push_back(std::move(bucket));
+        }
+    }
+    _numEmptyBuckets = 0;
+
+    // Leave room for the next bucket under the same load factor GetOrCreate grows at, so it does not rehash again.
+    auto capacity = kMinCapacity;
+    while ((_buckets.size() + 1) * kMaxLoadFactorInverse > capacity)
+    {
+        capacity *= 2;
+    }
+    Rehash(capacity);
+}
+
+void EntitySpatialIndex::Rehash(size_t capacity)
+{
+    _slots.assign(capacity, Slot{ kEmptyKey, nullptr });
+    _hashShift = 64 - std::countr_zero(capacity);
+    for (auto& bucket : _buckets)
+    {
+        _slots[FindSlot(bucket.Key)] = { bucket.Key, &bucket };
+    }
+}
+
+size_t EntitySpatialIndex::GetNumBuckets() const
+{
+    return _buckets.size();
+}
+
+size_t EntitySpatialIndex::GetMemoryUsage() const
+{
+    size_t result = _slots.capacity() * sizeof(Slot);
+    for (const auto& bucket : _buckets)
+    {
+        result += sizeof(bucket) + bucket.Entities.capacity() * sizeof(EntityId);
+    }
+    return result;
+}
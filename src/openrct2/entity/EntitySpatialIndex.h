@@ -0,0 +1,66 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../Identifiers.h"
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+/**
+ * Maps a spatial index (tile) to the entities on it, kept in sprite_index order.
+ * Only tiles that hold entities have a bucket, found through an open addressed hash table, so memory
+ * scales with the number of occupied tiles rather than the maximum map size. Buckets never move while
+ * the index is in use, references returned by Get stay valid until Trim is called.
+ */
+class EntitySpatialIndex
+{
+    struct Bucket
+    {
+        uint32_t Key;
+        std::vector<EntityId> Entities;
+    };
+
+    struct Slot
+    {
+        uint32_t Key;
+        Bucket* Target;
+    };
+
+    static constexpr uint32_t kEmptyKey = 0xFFFFFFFFu;
+    static constexpr size_t kMinCapacity = 1024;
+    // The table grows once more than one in this many slots are used.
+    static constexpr size_t kMaxLoadFactorInverse = 4;
+
+    std::vector<Slot> _slots;
+    uint32_t _hashShift{};
+    std::deque<Bucket> _buckets;
+    size_t _numEmptyBuckets{};
+
+public:
+    EntitySpatialIndex();
+
+    const std::vector<EntityId>& Get(uint32_t key) const;
+    void Insert(uint32_t key, EntityId id);
+    bool Remove(uint32_t key, EntityId id);
+    void Clear();
+
+    // Drops the buckets of tiles that no longer hold any entities.
+    void Trim();
+
+    size_t GetNumBuckets() const;
+    size_t GetMemoryUsage() const;
+
+private:
+    size_t FindSlot(uint32_t key) const;
+    std::vector<EntityId>& GetOrCreate(uint32_t key);
+    void Rehash(size_t capacity);
+};
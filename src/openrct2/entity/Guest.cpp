@@ -45,6 +45,7 @@
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
 #include "../ride/RideManager.hpp"
+#include "../ride/RideProximityIndex.h"
 #include "../ride/ShopItem.h"
 #include "../ride/Station.h"
 #include "../ride/Track.h"
@@ -1907,6 +1908,15 @@ OpenRCT2::BitSet<OpenRCT2::Limits::kMaxRidesInPark> Guest::FindRidesToGoOn()
             }
         }
     }
+    else if (RideProximityIndex::IsEnabled())
+    {
+        constexpr auto kRadiusTiles = 10;
+        const auto tile = TileCoordsXY(CoordsXY{ x, y });
+        RideProximityIndex::AddRidesInRange(
+            { tile.x - kRadiusTiles, tile.y - kRadiusTiles }, { tile.x + kRadiusTiles, tile.y + kRadiusTiles },
+            rideConsideration);
+        RideProximityIndex::AddLandmarkRides(rideConsideration);
+    }
     else
     {
         // Take nearby rides into consideration
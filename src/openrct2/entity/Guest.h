@@ -460,6 +460,9 @@ enum
 };
 
 void PeepThoughtSetFormatArgs(const PeepThought* thought, Formatter& ft);
+void GuestUpdateThoughts(std::array<PeepThought, kPeepMaxThoughts>& thoughts, uint8_t& windowInvalidateFlags);
+// Returns false once the guest has forgotten its previous ride.
+bool GuestUpdatePreviousRideTimeOut(uint16_t& previousRideTimeOut);
 
 void IncrementGuestsInPark();
 void IncrementGuestsHeadingForPark();
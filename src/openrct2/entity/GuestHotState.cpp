@@ -0,0 +1,160 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "GuestHotState.h"
+
+#include "../GameState.h"
+#include "EntityRegistry.h"
+#include "Guest.h"
+
+#include <array>
+#include <vector>
+
+namespace OpenRCT2::GuestHotState
+{
+    static constexpr uint16_t kNotArmed = 0xFFFF;
+
+    // Guests with any of these flags do more than advance counters on every tick.
+    static constexpr uint32_t kIneligibleFlags = PEEP_FLAGS_POSITION_FROZEN | PEEP_FLAGS_ANIMATION_FROZEN | PEEP_FLAGS_PURPLE
+        | PEEP_FLAGS_PIZZA | PEEP_FLAGS_CONTAGIOUS | PEEP_FLAGS_JOY | PEEP_FLAGS_ICE_CREAM;
+
+    static std::array<uint16_t, kMaxEntities> _slotOf = [] {
+        std::array<uint16_t, kMaxEntities> res{};
+        res.fill(kNotArmed);
+        return res;
+    }();
+
+    // Mirrored state, one element per armed guest.
+    static std::vector<EntityId> _ids;
+    static std::vector<uint8_t> _stepsToTake;
+    static std::vector<uint8_t> _stepProgress;
+    static std::vector<bool> _hasPreviousRide;
+    static std::vector<uint16_t> _previousRideTimeOut;
+    static std::vector<std::array<PeepThought, kPeepMaxThoughts>> _thoughts;
+    static std::vector<uint8_t> _windowInvalidateFlags;
+
+    static void Disarm(uint16_t slot)
+    {
+        _slotOf[_ids[slot].ToUnderlying()] = kNotArmed;
+
+        const auto last = _ids.size() - 1;
+        if (slot != last)
+        {
+            _ids[slot] = _ids[last];
+            _stepsToTake[slot] = _stepsToTake[last];
+            _stepProgress[slot] = _stepProgress[last];
+            _hasPreviousRide[slot] = _hasPreviousRide[last];
+            _previousRideTimeOut[slot] = _previousRideTimeOut[last];
+            _thoughts[slot] = _thoughts[last];
+            _windowInvalidateFlags[slot] = _windowInvalidateFlags[last];
+            _slotOf[_ids[slot].ToUnderlying()] = static_cast<uint16_t>(slot);
+        }
+
+        _ids.pop_back();
+        _stepsToTake.pop_back();
+        _stepProgress.pop_back();
+        _hasPreviousRide.pop_back();
+        _previousRideTimeOut.pop_back();
+        _thoughts.pop_back();
+        _windowInvalidateFlags.pop_back();
+    }
+
+    bool TryArm(Guest& guest)
+    {
+        if (guest.PeepFlags & kIneligibleFlags)
+            return false;
+
+        // Below this speed the walking speed depends on vehicles on level crossings.
+        const auto stepsToTake = guest.GetWalkingSteps();
+        if (stepsToTake < kPeepMinStepsForLevelCrossing)
+            return false;
+
+        const auto index = guest.Id.ToUnderlying();
+        if (index >= kMaxEntities || _slotOf[index] != kNotArmed)
+            return false;
+
+        _slotOf[index] = static_cast<uint16_t>(_ids.size());
+        _ids.push_back(guest.Id);
+        _stepsToTake.push_back(static_cast<uint8_t>(stepsToTake));
+        _stepProgress.push_back(guest.StepProgress);
+        _hasPreviousRide.push_back(!guest.PreviousRide.IsNull());
+        _previousRideTimeOut.push_back(guest.PreviousRideTimeOut);
+        _thoughts.push_back(guest.Thoughts);
+        _windowInvalidateFlags.push_back(0);
+        return true;
+    }
+
+    bool TryUpdate(EntityId id)
+    {
+        const auto index = id.ToUnderlying();
+        if (index >= kMaxEntities)
+            return false;
+
+        const auto slot = _slotOf[index];
+        if (slot == kNotArmed)
+            return false;
+
+        // Taking a step needs the full update.
+        const uint32_t carryCheck = _stepProgress[slot] + _stepsToTake[slot];
+        if (carryCheck > 255)
+            return false;
+
+        // Mirrors Peep::Update for a guest that does not take a step.
+        if (_hasPreviousRide[slot])
+            _hasPreviousRide[slot] = GuestUpdatePreviousRideTimeOut(_previousRideTimeOut[slot]);
+        GuestUpdateThoughts(_thoughts[slot], _windowInvalidateFlags[slot]);
+        _stepProgress[slot] = static_cast<uint8_t>(carryCheck);
+        return true;
+    }
+
+    bool IsArmed(EntityId id)
+    {
+        const auto index = id.ToUnderlying();
+        return index < kMaxEntities && _slotOf[index] != kNotArmed;
+    }
+
+    void Flush(Guest& guest)
+    {
+        const auto slot = _slotOf[guest.Id.ToUnderlying()];
+        if (slot == kNotArmed)
+            return;
+
+        guest.StepProgress = _stepProgress[slot];
+        if (!_hasPreviousRide[slot])
+            guest.PreviousRide = RideId::GetNull();
+        guest.PreviousRideTimeOut = _previousRideTimeOut[slot];
+        guest.Thoughts = _thoughts[slot];
+        guest.WindowInvalidateFlags |= _windowInvalidateFlags[slot];
+
+        Disarm(slot);
+    }
+
+    void FlushAll()
+    {
+        // Written back through the slots directly, TryGetEntity only does so while the option is on.
+        auto& entities = GetGameState().Entities;
+        while (!_ids.empty())
+        {
+            Flush(*reinterpret_cast<Guest*>(&entities[_ids.back().ToUnderlying()].base));
+        }
+    }
+
+    void Clear()
+    {
+        while (!_ids.empty())
+        {
+            Disarm(static_cast<uint16_t>(_ids.size() - 1));
+        }
+    }
+
+    size_t GetNumArmed()
+    {
+        return _ids.size();
+    }
+} // namespace OpenRCT2::GuestHotState
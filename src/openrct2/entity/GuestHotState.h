@@ -0,0 +1,50 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../Identifiers.h"
+
+#include <cstddef>
+
+struct Guest;
+
+/**
+ * Structure-of-arrays mirror of the guest fields that change on ticks where a guest does not take a step:
+ * step progress, previous ride timeout and thought ageing. PeepUpdateAll handles those ticks from the mirror
+ * without touching the 512 byte entity slot. Position, state, sub-state and destination only change when a
+ * guest takes a step, and energy and happiness only in the 128 tick update, both of which run the full update
+ * on the entity, so they are not mirrored.
+ *
+ * A guest is armed after a full update and stays armed until anything obtains it through the entity registry,
+ * TryGetEntity writes the mirrored fields back before handing out the pointer. Serialisation, checksums and
+ * snapshots therefore always see the same state as without the mirror. Viewport painting flushes everything
+ * first as it reads entities from several threads, so the mirror is mostly useful for headless servers.
+ * TryGetEntity only checks for armed guests while guest_hot_state_mirror is on, PeepUpdateAll flushes every
+ * guest on the first tick after the option is turned off.
+ */
+namespace OpenRCT2::GuestHotState
+{
+    // Arms a guest that has just been updated, returns false if the guest is not eligible.
+    bool TryArm(Guest& guest);
+
+    // Performs the tick for an armed guest if it will not take a step, otherwise returns false.
+    bool TryUpdate(EntityId id);
+
+    bool IsArmed(EntityId id);
+
+    // Writes the mirrored fields back into the entity and disarms it.
+    void Flush(Guest& guest);
+    void FlushAll();
+
+    // Disarms everything without writing back, used when the entities themselves are reset.
+    void Clear();
+
+    size_t GetNumArmed();
+} // namespace OpenRCT2::GuestHotState
@@ -28,6 +28,7 @@
 #include "../entity/Balloon.h"
 #include "../entity/EntityRegistry.h"
 #include "../entity/EntityTweener.h"
+#include "../entity/GuestHotState.h"
 #include "../interface/Viewport.h"
 #include "../interface/Window_internal.h"
 #include "../localisation/Formatter.h"
@@ -44,6 +45,7 @@
 #include "../profiling/Profiling.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
+#include "../ride/RideProximityIndex.h"
 #include "../ride/ShopItem.h"
 #include "../ride/Station.h"
 #include "../ride/Track.h"
@@ -209,10 +211,37 @@ void PeepUpdateAll()
     constexpr auto kTicks128Mask = 128u - 1u;
     const auto currentTicksMasked = currentTicks & kTicks128Mask;
 
+    const auto& config = Config::Get().general;
+    const bool useHotState = config.GuestHotStateMirror;
+    if (!useHotState)
+    {
+        GuestHotState::FlushAll();
+    }
+    if (config.RideProximityIndex)
+    {
+        RideProximityIndex::BeginGuestUpdate();
+    }
+
     uint32_t index = 0;
     // Warning this loop can delete peeps
-    for (auto peep : EntityList<Guest>())
+    const auto& guestIds = GetEntityList(EntityType::Guest);
+    for (auto it = guestIds.begin(); it != guestIds.end();)
     {
+        const auto guestId = *it++;
+
+        // Guests that only advance their step progress this tick are updated without touching the entity.
+        if ((index & kTicks128Mask) != currentTicksMasked && GuestHotState::TryUpdate(guestId))
+        {
+            index++;
+            continue;
+        }
+
+        auto* peep = GetEntity<Guest>(guestId);
+        if (peep == nullptr)
+        {
+            continue;
+        }
+
         if ((index & kTicks128Mask) == currentTicksMasked)
         {
             peep->Tick128UpdateGuest(index);
@@ -222,10 +251,16 @@ void PeepUpdateAll()
         if (peep->Type == EntityType::Guest)
         {
             peep->Update();
+
+            if (useHotState && peep->Type == EntityType::Guest)
+            {
+                GuestHotState::TryArm(*peep);
+            }
         }
 
         index++;
     }
+    RideProximityIndex::EndGuestUpdate();
 
     for (auto staff : EntityList<Staff>())
     {
@@ -929,8 +964,13 @@ void Peep::UpdatePicked()
     }
 }
 
+bool GuestUpdatePreviousRideTimeOut(uint16_t& previousRideTimeOut)
+{
+    return ++previousRideTimeOut < 720;
+}
+
 /* From peep_update */
-static void GuestUpdateThoughts(Guest* peep)
+void GuestUpdateThoughts(std::array<PeepThought, kPeepMaxThoughts>& thoughts, uint8_t& windowInvalidateFlags)
 {
     // Thoughts must always have a gap of at least
     // 220 ticks in age between them. In order to
@@ -940,37 +980,37 @@ static void GuestUpdateThoughts(Guest* peep)
     int32_t fresh_thought = -1;
     for (int32_t i = 0; i < kPeepMaxThoughts; i++)
     {
-        if (peep->Thoughts[i].type == PeepThoughtType::None)
+        if (thoughts[i].type == PeepThoughtType::None)
             break;
 
-        if (peep->Thoughts[i].freshness == 1)
+        if (thoughts[i].freshness == 1)
         {
             add_fresh = 0;
             // If thought is fresh we wait 220 ticks
             // before allowing a new thought to become fresh.
-            if (++peep->Thoughts[i].fresh_timeout >= 220)
+            if (++thoughts[i].fresh_timeout >= 220)
             {
-                peep->Thoughts[i].fresh_timeout = 0;
+                thoughts[i].fresh_timeout = 0;
                 // Thought is no longer fresh
-                peep->Thoughts[i].freshness++;
+                thoughts[i].freshness++;
                 add_fresh = 1;
             }
         }
-        else if (peep->Thoughts[i].freshness > 1)
+        else if (thoughts[i].freshness > 1)
         {
-            if (++peep->Thoughts[i].fresh_timeout == 0)
+            if (++thoughts[i].fresh_timeout == 0)
             {
                 // When thought is older than ~6900 ticks remove it
-                if (++peep->Thoughts[i].freshness >= 28)
+                if (++thoughts[i].freshness >= 28)
                 {
-                    peep->WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_THOUGHTS;
+                    windowInvalidateFlags |= PEEP_INVALIDATE_PEEP_THOUGHTS;
 
                     // Clear top thought, push others up
                     if (i < kPeepMaxThoughts - 2)
                     {
-                        memmove(&peep->Thoughts[i], &peep->Thoughts[i + 1], sizeof(PeepThought) * (kPeepMaxThoughts - i - 1));
+                        memmove(&thoughts[i], &thoughts[i + 1], sizeof(PeepThought) * (kPeepMaxThoughts - i - 1));
                     }
-                    peep->Thoughts[kPeepMaxThoughts - 1].type = PeepThoughtType::None;
+                    thoughts[kPeepMaxThoughts - 1].type = PeepThoughtType::None;
                 }
             }
         }
@@ -984,9 +1024,26 @@ static void GuestUpdateThoughts(Guest* peep)
     // fresh.
     if (add_fresh && fresh_thought != -1)
     {
-        peep->Thoughts[fresh_thought].freshness = 1;
-        peep->WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_THOUGHTS;
+        thoughts[fresh_thought].freshness = 1;
+        windowInvalidateFlags |= PEEP_INVALIDATE_PEEP_THOUGHTS;
+    }
+}
+
+// Walking speed logic, not accounting for level crossings
+uint32_t Peep::GetWalkingSteps() const
+{
+    uint32_t stepsToTake = Energy;
+    if (stepsToTake < 95 && State == PeepState::Queuing)
+        stepsToTake = 95;
+    if ((PeepFlags & PEEP_FLAGS_SLOW_WALK) && State != PeepState::Queuing)
+        stepsToTake /= 2;
+    if (IsActionWalking() && GetNextIsSloped())
+    {
+        stepsToTake /= 2;
+        if (State == PeepState::Queuing)
+            stepsToTake += stepsToTake / 2;
     }
+    return stepsToTake;
 }
 
 /**
@@ -1022,29 +1079,16 @@ void Peep::Update()
     auto* guest = As<Guest>();
     if (guest != nullptr)
     {
-        if (!guest->PreviousRide.IsNull())
-            if (++guest->PreviousRideTimeOut >= 720)
-                guest->PreviousRide = RideId::GetNull();
+        if (!guest->PreviousRide.IsNull() && !GuestUpdatePreviousRideTimeOut(guest->PreviousRideTimeOut))
+            guest->PreviousRide = RideId::GetNull();
 
-        GuestUpdateThoughts(guest);
+        GuestUpdateThoughts(guest->Thoughts, WindowInvalidateFlags);
     }
 
-    // Walking speed logic
-    uint32_t stepsToTake = Energy;
-    if (stepsToTake < 95 && State == PeepState::Queuing)
-        stepsToTake = 95;
-    if ((PeepFlags & PEEP_FLAGS_SLOW_WALK) && State != PeepState::Queuing)
-        stepsToTake /= 2;
-    if (IsActionWalking() && GetNextIsSloped())
-    {
-        stepsToTake /= 2;
-        if (State == PeepState::Queuing)
-            stepsToTake += stepsToTake / 2;
-    }
+    uint32_t stepsToTake = GetWalkingSteps();
     // Ensure guests make it across a level crossing in time
-    constexpr auto minStepsForCrossing = 55;
-    if (stepsToTake < minStepsForCrossing && IsOnPathBlockedByVehicle())
-        stepsToTake = minStepsForCrossing;
+    if (stepsToTake < kPeepMinStepsForLevelCrossing && IsOnPathBlockedByVehicle())
+        stepsToTake = kPeepMinStepsForLevelCrossing;
 
     uint32_t carryCheck = StepProgress + stepsToTake;
     StepProgress = carryCheck;
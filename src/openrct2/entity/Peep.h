@@ -24,6 +24,8 @@
 constexpr uint8_t kPeepMinEnergy = 32;
 constexpr uint8_t kPeepMaxEnergy = 128;
 constexpr uint8_t kPeepMaxEnergyTarget = 255; // Oddly, this differs from max energy!
+// Minimum walking speed that ensures guests make it across a level crossing in time
+constexpr uint8_t kPeepMinStepsForLevelCrossing = 55;
 
 constexpr auto kPeepClearanceHeight = 4 * kCoordsZStep;
 
@@ -383,6 +385,7 @@ public: // Peep
     bool SetName(std::string_view value);
     bool IsActionWalking() const;
     bool IsActionIdle() const;
+    uint32_t GetWalkingSteps() const;
     bool IsActionInterruptable() const;
 
     // Reset the peep's stored goal, which means they will forget any stored pathfinding history
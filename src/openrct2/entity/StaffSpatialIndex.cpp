@@ -0,0 +1,57 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "StaffSpatialIndex.h"
+
+#include "EntityList.h"
+
+void StaffSpatialIndex::Build()
+{
+    Clear();
+    for (auto* staff : EntityList<Staff>())
+    {
+        if (staff->x == kLocationNull)
+            continue;
+
+        const auto type = EnumValue(staff->AssignedStaffType);
+        if (type >= _grids.size())
+            continue;
+
+        auto& grid = _grids[type];
+        if (grid.empty())
+        {
+            grid.resize(kNumCellsPerSide * kNumCellsPerSide);
+        }
+
+        grid[GetCell(staff->y) * kNumCellsPerSide + GetCell(staff->x)].push_back({ staff->Id, staff->GetLocation() });
+        _counts[type]++;
+    }
+    _isBuilt = true;
+}
+
+void StaffSpatialIndex::Clear()
+{
+    if (!_isBuilt)
+        return;
+
+    for (auto& grid : _grids)
+    {
+        for (auto& cell : grid)
+        {
+            cell.clear();
+        }
+    }
+    _counts = {};
+    _isBuilt = false;
+}
+
+bool StaffSpatialIndex::IsBuilt() const
+{
+    return _isBuilt;
+}
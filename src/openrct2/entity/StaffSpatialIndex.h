@@ -0,0 +1,123 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../core/EnumUtils.hpp"
+#include "../world/Location.hpp"
+#include "../world/Map.h"
+#include "EntityRegistry.h"
+#include "Staff.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+/**
+ * Snapshot of the staff positions, bucketed by staff type into cells of 16x16 tiles.
+ *
+ * FindClosest searches the cells in rings around the location and stops once no cell left can hold anyone
+ * closer, asking the predicate about availability and patrol areas only for staff that would be closer
+ * than the best so far. The result is the same as a scan of all staff in sprite order: the lowest id among
+ * the available staff at the shortest Manhattan distance.
+ *
+ * The snapshot is only valid while no staff move, it has to be rebuilt after entities have been updated.
+ */
+class StaffSpatialIndex
+{
+    struct Entry
+    {
+        EntityId Id;
+        CoordsXY Location;
+    };
+
+    static constexpr int32_t kCellSize = 16 * kCoordsXYStep;
+    static constexpr int32_t kNumCellsPerSide = (kMaximumMapSizeTechnical * kCoordsXYStep + kCellSize - 1) / kCellSize;
+
+    using Grid = std::vector<std::vector<Entry>>;
+
+    std::array<Grid, EnumValue(StaffType::Count)> _grids;
+    std::array<size_t, EnumValue(StaffType::Count)> _counts{};
+    bool _isBuilt{};
+
+public:
+    void Build();
+    void Clear();
+    bool IsBuilt() const;
+
+    template<typename TPredicate>
+    Staff* FindClosest(StaffType type, const CoordsXY& loc, TPredicate&& isAvailable) const
+    {
+        const auto& grid = _grids[EnumValue(type)];
+        if (_counts[EnumValue(type)] == 0)
+            return nullptr;
+
+        Staff* closest = nullptr;
+        uint32_t closestDistance = std::numeric_limits<uint32_t>::max();
+        EntityId closestId = EntityId::GetNull();
+
+        auto visitCell = [&](int32_t cellX, int32_t cellY) {
+            for (const auto& entry : grid[cellY * kNumCellsPerSide + cellX])
+            {
+                const uint32_t distance = std::abs(entry.Location.x - loc.x) + std::abs(entry.Location.y - loc.y);
+                if (distance > closestDistance || (distance == closestDistance && entry.Id > closestId))
+                    continue;
+
+                auto* staff = GetEntity<Staff>(entry.Id);
+                if (staff != nullptr && isAvailable(*staff))
+                {
+                    closest = staff;
+                    closestDistance = distance;
+                    closestId = entry.Id;
+                }
+            }
+        };
+
+        const auto originX = GetCell(loc.x);
+        const auto originY = GetCell(loc.y);
+        for (int32_t ring = 0; ring < kNumCellsPerSide; ring++)
+        {
+            // Every cell of the ring is at least this far away on one axis.
+            const auto minDistance = static_cast<uint32_t>(std::max(ring - 1, 0) * kCellSize);
+            if (minDistance > closestDistance)
+                break;
+
+            const auto minX = std::max(originX - ring, 0);
+            const auto maxX = std::min(originX + ring, kNumCellsPerSide - 1);
+            const auto minY = std::max(originY - ring, 0);
+            const auto maxY = std::min(originY + ring, kNumCellsPerSide - 1);
+            for (auto cellY = minY; cellY <= maxY; cellY++)
+            {
+                if (cellY == originY - ring || cellY == originY + ring)
+                {
+                    for (auto cellX = minX; cellX <= maxX; cellX++)
+                    {
+                        visitCell(cellX, cellY);
+                    }
+                }
+                else
+                {
+                    if (originX - ring >= 0)
+                        visitCell(originX - ring, cellY);
+                    if (originX + ring < kNumCellsPerSide)
+                        visitCell(originX + ring, cellY);
+                }
+            }
+        }
+        return closest;
+    }
+
+private:
+    static int32_t GetCell(int32_t coord)
+    {
+        return std::clamp(coord / kCellSize, 0, kNumCellsPerSide - 1);
+    }
+};
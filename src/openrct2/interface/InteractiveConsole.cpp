@@ -1973,6 +1973,8 @@ void InteractiveConsole::Execute(const std::string& s)
         {
             argv.erase(argv.begin());
             c.func(*this, argv);
+            // Commands can change the park directly rather than through game actions.
+            NetworkInvalidateCachedMaps();
             validCommand = true;
             break;
         }
@@ -35,12 +35,17 @@
 #include "../world/tile_element/SurfaceElement.h"
 #include "Viewport.h"
 
+#include <algorithm>
+#include <array>
 #include <cctype>
 #include <chrono>
 #include <cstdlib>
+#include <future>
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 using namespace std::literals::string_literals;
 using namespace OpenRCT2;
@@ -227,34 +232,6 @@ static int32_t GetTallestVisibleTileTop(
     return minViewY - 64;
 }
 
-static DrawPixelInfo CreateDPI(const Viewport& viewport)
-{
-    DrawPixelInfo dpi;
-    dpi.width = viewport.width;
-    dpi.height = viewport.height;
-    dpi.bits = new (std::nothrow) uint8_t[dpi.width * dpi.height];
-    if (dpi.bits == nullptr)
-    {
-        throw std::runtime_error("Giant screenshot failed, unable to allocate memory for image.");
-    }
-
-    if (viewport.flags & VIEWPORT_FLAG_TRANSPARENT_BACKGROUND)
-    {
-        std::memset(dpi.bits, PALETTE_INDEX_0, static_cast<size_t>(dpi.width) * dpi.height);
-    }
-
-    return dpi;
-}
-
-static void ReleaseDPI(DrawPixelInfo& dpi)
-{
-    if (dpi.bits != nullptr)
-        delete[] dpi.bits;
-    dpi.bits = nullptr;
-    dpi.width = 0;
-    dpi.height = 0;
-}
-
 static Viewport GetGiantViewport(int32_t rotation, ZoomLevel zoom)
 {
     auto& gameState = GetGameState();
@@ -305,24 +282,78 @@ static Viewport GetGiantViewport(int32_t rotation, ZoomLevel zoom)
     return viewport;
 }
 
-static void RenderViewport(IDrawingEngine* drawingEngine, const Viewport& viewport, DrawPixelInfo& dpi)
+// At most this many pixels of the image are held at once, in each of the two bands of rows.
+static constexpr size_t kMaxBandPixels = 32 * 1024 * 1024;
+static constexpr int32_t kMinBandHeight = 64;
+
+// Renders the viewport one band of rows at a time and streams each band into the PNG while the next one is rendered,
+// so the memory used does not grow with the size of the image. The columns of each band are painted in parallel by
+// the paint jobs of ViewportRender.
+static bool RenderViewportToFile(const Viewport& viewport, std::string_view path, const GamePalette& palette)
 {
-    // Ensure sprites appear regardless of rotation
-    ResetAllSpriteQuadrantPlacements();
+    // The paint cache would record whole columns of the image for every band and is never replayed for a single render.
+    auto& general = Config::Get().general;
+    const auto cachePaintColumns = std::exchange(general.CachePaintColumns, false);
+    bool result = false;
+    try
+    {
+        // Ensure sprites appear regardless of rotation
+        ResetAllSpriteQuadrantPlacements();
+
+        Image header;
+        header.Width = viewport.width;
+        header.Height = viewport.height;
+        header.Depth = 8;
+        header.Palette = palette;
+        auto writer = Imaging::CreatePngRowWriter(path, header);
+
+        const auto width = static_cast<size_t>(viewport.width);
+        const auto rows = static_cast<int32_t>(kMaxBandPixels / std::max<size_t>(width, 1));
+        const auto bandHeight = std::min(std::max(rows, kMinBandHeight), viewport.height);
 
-    std::unique_ptr<X8DrawingEngine> tempDrawingEngine;
-    if (drawingEngine == nullptr)
+        X8DrawingEngine drawingEngine(GetContext()->GetUiContext());
+        std::array<std::vector<uint8_t>, 2> bands;
+        std::future<void> pendingWrite;
+        for (int32_t y = 0, band = 0; y < viewport.height; y += bandHeight, band ^= 1)
+        {
+            const auto height = std::min(bandHeight, viewport.height - y);
+            auto& pixels = bands[band];
+            pixels.assign(width * height, PALETTE_INDEX_0);
+
+            DrawPixelInfo dpi;
+            dpi.bits = pixels.data();
+            dpi.y = y;
+            dpi.width = viewport.width;
+            dpi.height = height;
+            dpi.DrawingEngine = &drawingEngine;
+            ViewportRender(dpi, &viewport);
+
+            // The other band is free again once it has been written.
+            if (pendingWrite.valid())
+            {
+                pendingWrite.get();
+            }
+            pendingWrite = std::async(std::launch::async, [&writer, &pixels, width, height]() {
+                writer->WriteRows(pixels.data(), height, static_cast<uint32_t>(width));
+            });
+        }
+        if (pendingWrite.valid())
+        {
+            pendingWrite.get();
+        }
+        writer->Finish();
+        result = true;
+    }
+    catch (const std::exception& e)
     {
-        tempDrawingEngine = std::make_unique<X8DrawingEngine>(GetContext()->GetUiContext());
-        drawingEngine = tempDrawingEngine.get();
+        LOG_ERROR("Unable to write png: %s", e.what());
     }
-    dpi.DrawingEngine = drawingEngine;
-    ViewportRender(dpi, &viewport);
+    general.CachePaintColumns = cachePaintColumns;
+    return result;
 }
 
 void ScreenshotGiant()
 {
-    DrawPixelInfo dpi{};
     try
     {
         auto path = ScreenshotGetNextPath();
@@ -350,10 +381,10 @@ void ScreenshotGiant()
             viewport.flags |= VIEWPORT_FLAG_TRANSPARENT_BACKGROUND;
         }
 
-        dpi = CreateDPI(viewport);
-
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(path.value(), dpi, gPalette);
+        if (!RenderViewportToFile(viewport, path.value(), gPalette))
+        {
+            throw std::runtime_error("Giant screenshot failed, unable to write the image.");
+        }
 
         // Show user that screenshot saved successfully
         const auto filename = Path::GetFileName(path.value());
@@ -367,8 +398,6 @@ void ScreenshotGiant()
         LOG_ERROR("%s", e.what());
         ContextShowError(STR_SCREENSHOT_FAILED, kStringIdNone, {}, true);
     }
-
-    ReleaseDPI(dpi);
 }
 
 static void ApplyOptions(const ScreenshotOptions* options, Viewport& viewport)
@@ -441,7 +470,6 @@ int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOpti
     }
 
     int32_t exitCode = 1;
-    DrawPixelInfo dpi;
     try
     {
         bool customLocation = false;
@@ -541,17 +569,16 @@ int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOpti
 
         ApplyOptions(options, viewport);
 
-        dpi = CreateDPI(viewport);
-
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(outputPath, dpi, gPalette);
+        if (!RenderViewportToFile(viewport, outputPath, gPalette))
+        {
+            throw std::runtime_error("Failed to write the image.");
+        }
     }
     catch (const std::exception& e)
     {
         std::printf("%s\n", e.what());
         exitCode = -1;
     }
-    ReleaseDPI(dpi);
 
     DrawingEngineDispose();
 
@@ -634,8 +661,5 @@ void CaptureImage(const CaptureOptions& options)
     }
 
     auto outputPath = ResolveFilenameForCapture(options.Filename);
-    auto dpi = CreateDPI(viewport);
-    RenderViewport(nullptr, viewport, dpi);
-    WriteDpiToFile(outputPath, dpi, gPalette);
-    ReleaseDPI(dpi);
+    RenderViewportToFile(viewport, outputPath, gPalette);
 }
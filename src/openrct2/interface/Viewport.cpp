@@ -17,18 +17,20 @@
 #include "../OpenRCT2.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
-#include "../core/JobPool.h"
 #include "../core/Numerics.hpp"
+#include "../core/TaskScheduler.h"
 #include "../drawing/Drawing.h"
 #include "../drawing/IDrawingEngine.h"
 #include "../entity/EntityList.h"
 #include "../entity/Guest.h"
+#include "../entity/GuestHotState.h"
 #include "../entity/PatrolArea.h"
 #include "../entity/Staff.h"
 #include "../object/LargeSceneryEntry.h"
 #include "../object/SmallSceneryEntry.h"
 #include "../object/WallSceneryEntry.h"
 #include "../paint/Paint.h"
+#include "../paint/PaintCache.h"
 #include "../profiling/Profiling.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
@@ -48,6 +50,7 @@
 
 #include <cstring>
 #include <list>
+#include <optional>
 #include <unordered_map>
 
 namespace OpenRCT2
@@ -68,7 +71,6 @@ namespace OpenRCT2
     static std::list<Viewport> _viewports;
     Viewport* g_music_tracking_viewport;
 
-    static std::unique_ptr<JobPool> _paintJobs;
     static std::vector<PaintSession*> _paintColumns;
 
     InteractionInfo::InteractionInfo(const PaintStruct* ps)
@@ -925,12 +927,12 @@ namespace OpenRCT2
         ViewportPaint(viewport, dpi);
     }
 
-    static void ViewportFillColumn(PaintSession& session)
+    static void ViewportFillColumn(PaintSession& session, TaskScheduler* sortJobs)
     {
         PROFILED_FUNCTION();
 
         PaintSessionGenerate(session);
-        PaintSessionArrange(session);
+        PaintSessionArrange(session, sortJobs);
     }
 
     static void ViewportPaintColumn(PaintSession& session)
@@ -978,6 +980,9 @@ namespace OpenRCT2
     {
         PROFILED_FUNCTION();
 
+        // Paint jobs look up entities concurrently, they must not write back mirrored guest state.
+        GuestHotState::FlushAll();
+
         const int32_t offsetX = dpi.x - viewport->pos.x;
         const int32_t offsetY = dpi.y - viewport->pos.y;
         const int32_t worldX = viewport->zoom.ApplyInversedTo(viewport->viewPos.x) + std::max(0, offsetX);
@@ -999,19 +1004,29 @@ namespace OpenRCT2
         _paintColumns.clear();
 
         bool useMultithreading = Config::Get().general.MultiThreading;
-        if (useMultithreading && _paintJobs == nullptr)
+
+        bool useParallelDrawing = false;
+        if (useMultithreading && (dpi.DrawingEngine->GetFlags() & DEF_PARALLEL_DRAWING))
         {
-            _paintJobs = std::make_unique<JobPool>();
+            useParallelDrawing = true;
         }
-        else if (useMultithreading == false && _paintJobs != nullptr)
+
+        std::optional<TaskGroup> columnTasks;
+        if (useMultithreading)
         {
-            _paintJobs.reset();
+            columnTasks.emplace(TaskScheduler::GetShared());
         }
 
-        bool useParallelDrawing = false;
-        if (useMultithreading && (dpi.DrawingEngine->GetFlags() & DEF_PARALLEL_DRAWING))
+        TaskScheduler* sortJobs = nullptr;
+        if (useMultithreading && Config::Get().general.ParallelPaintSort)
         {
-            useParallelDrawing = true;
+            sortJobs = &TaskScheduler::GetShared();
+        }
+
+        const bool usePaintCache = PaintCache::IsEnabled();
+        if (usePaintCache)
+        {
+            PaintCache::Trim();
         }
 
         const int32_t columnWidth = worldDpi.zoom_level.ApplyInversedTo(kCoordsXYStep);
@@ -1043,19 +1058,31 @@ namespace OpenRCT2
             }
             columnDpi.width = paintRight - columnDpi.x;
 
-            if (useMultithreading)
+            if (usePaintCache)
             {
-                _paintJobs->AddTask([session]() -> void { ViewportFillColumn(*session); });
+                // The cached tiles are painted for the whole column, whichever part of the viewport is redrawn.
+                DrawPixelInfo cacheDpi;
+                cacheDpi.x = x;
+                cacheDpi.y = viewport->zoom.ApplyInversedTo(viewport->viewPos.y);
+                cacheDpi.width = columnWidth;
+                cacheDpi.height = viewport->height;
+                cacheDpi.zoom_level = viewport->zoom;
+                session->CacheColumn = PaintCache::GetColumn(cacheDpi, viewport->flags, viewport->rotation);
+            }
+
+            if (columnTasks.has_value())
+            {
+                columnTasks->Run([session, sortJobs]() -> void { ViewportFillColumn(*session, sortJobs); });
             }
             else
             {
-                ViewportFillColumn(*session);
+                ViewportFillColumn(*session, sortJobs);
             }
         }
 
-        if (useMultithreading)
+        if (columnTasks.has_value())
         {
-            _paintJobs->Join();
+            columnTasks->Wait();
         }
 
         // Paint columns.
@@ -1063,7 +1090,7 @@ namespace OpenRCT2
         {
             if (useParallelDrawing)
             {
-                _paintJobs->AddTask([session]() -> void { ViewportPaintColumn(*session); });
+                columnTasks->Run([session]() -> void { ViewportPaintColumn(*session); });
             }
             else
             {
@@ -1072,7 +1099,7 @@ namespace OpenRCT2
         }
         if (useParallelDrawing)
         {
-            _paintJobs->Join();
+            columnTasks->Wait();
         }
 
         // Release resources.
@@ -50,7 +50,7 @@ using namespace OpenRCT2;
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
 
-constexpr uint8_t kNetworkStreamVersion = 4;
+constexpr uint8_t kNetworkStreamVersion = 5;
 
 const std::string kNetworkStreamID = std::string(kOpenRCT2Version) + "-" + std::to_string(kNetworkStreamVersion);
 
@@ -202,6 +202,7 @@ void NetworkBase::Close()
         CloseConnection();
 
         client_connection_list.clear();
+        _cachedMaps.clear();
         GameActions::ClearQueue();
         GameActions::ResumeQueue();
         player_list.clear();
@@ -787,6 +788,8 @@ const char* NetworkBase::FormatChat(NetworkPlayer* fromPlayer, const char* text)
 
 void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, bool gameCmd) const
 {
+    // Serialised once and shared by all connections.
+    NetworkPacketBuffer buffer;
     for (auto& client_connection : client_connection_list)
     {
         if (gameCmd)
@@ -800,7 +803,11 @@ void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, b
                 continue;
             }
         }
-        client_connection->QueuePacket(packet, front);
+        if (buffer == nullptr)
+        {
+            buffer = NetworkConnection::SerialisePacket(packet);
+        }
+        client_connection->QueuePacket(packet, buffer, front);
     }
 }
 
@@ -825,7 +832,8 @@ bool NetworkBase::CheckSRAND(uint32_t tick, uint32_t srand0)
 
     if (!storedTick.spriteHash.empty())
     {
-        EntitiesChecksum checksum = GetAllEntitiesChecksum();
+        EntitiesChecksum checksum = storedTick.spriteHashIsIncremental ? GetAllEntitiesIncrementalChecksum()
+                                                                       : GetAllEntitiesChecksum();
         std::string clientSpriteHash = checksum.ToString();
         if (clientSpriteHash != storedTick.spriteHash)
         {
@@ -1468,7 +1476,23 @@ void NetworkBase::ServerSendMap(NetworkConnection* connection)
         objects = objManager.GetPackableObjects();
     }
 
-    auto header = SaveForNetwork(objects);
+    std::vector<uint8_t> savedMap;
+    const std::vector<uint8_t>* mapData = &savedMap;
+    if (Config::Get().network.CacheMapForJoins)
+    {
+        if (connection == nullptr)
+        {
+            // A new park has been loaded.
+            _cachedMaps.clear();
+        }
+        mapData = &GetCachedMapForNetwork(objects);
+    }
+    else
+    {
+        savedMap = SaveForNetwork(objects);
+    }
+
+    const auto& header = *mapData;
     if (header.empty())
     {
         if (connection != nullptr)
@@ -1512,6 +1536,31 @@ std::vector<uint8_t> NetworkBase::SaveForNetwork(const std::vector<const ObjectR
     return result;
 }
 
+const std::vector<uint8_t>& NetworkBase::GetCachedMapForNetwork(const std::vector<const ObjectRepositoryItem*>& objects)
+{
+    // Between ticks the park changes through game actions, tile element changes, plugins and console commands,
+    // all of which drop the cached maps.
+    const auto currentTick = GetGameState().CurrentTicks;
+    if (currentTick != _cachedMapsTick)
+    {
+        _cachedMaps.clear();
+        _cachedMapsTick = currentTick;
+    }
+
+    auto it = std::find_if(
+        _cachedMaps.begin(), _cachedMaps.end(), [&objects](const CachedMap& cachedMap) { return cachedMap.Objects == objects; });
+    if (it != _cachedMaps.end())
+    {
+        return it->Data;
+    }
+    return _cachedMaps.emplace_back(CachedMap{ objects, SaveForNetwork(objects) }).Data;
+}
+
+void NetworkBase::InvalidateCachedMaps()
+{
+    _cachedMaps.clear();
+}
+
 void NetworkBase::Client_Send_CHAT(const char* text)
 {
     NetworkPacket packet(NetworkCommand::Chat);
@@ -1531,12 +1580,13 @@ void NetworkBase::ServerSendChat(const char* text, const std::vector<uint8_t>& p
     }
     else
     {
+        auto buffer = NetworkConnection::SerialisePacket(packet);
         for (auto playerId : playerIds)
         {
             auto conn = GetPlayerConnection(playerId);
             if (conn != nullptr)
             {
-                conn->QueuePacket(packet);
+                conn->QueuePacket(packet, buffer);
             }
         }
     }
@@ -1573,6 +1623,9 @@ void NetworkBase::ServerSendGameAction(const GameAction* action)
     packet << GetGameState().CurrentTicks << action->GetType() << stream;
 
     SendPacketToClients(packet);
+
+    // The action has changed the park after the cached maps were saved.
+    InvalidateCachedMaps();
 }
 
 void NetworkBase::ServerSendTick()
@@ -1585,7 +1638,13 @@ void NetworkBase::ServerSendTick()
     // but debug version can check more often.
     static int32_t checksum_counter = 0;
     checksum_counter++;
-    if (checksum_counter >= 100)
+    if (Config::Get().general.IncrementalEntityChecksum)
+    {
+        // Only the entities that changed are serialised, cheap enough to send every tick.
+        checksum_counter = 0;
+        flags |= NETWORK_TICK_FLAG_CHECKSUMS | NETWORK_TICK_FLAG_INCREMENTAL_CHECKSUMS;
+    }
+    else if (checksum_counter >= 100)
     {
         checksum_counter = 0;
         flags |= NETWORK_TICK_FLAG_CHECKSUMS;
@@ -1593,7 +1652,12 @@ void NetworkBase::ServerSendTick()
     // Send flags always, so we can understand packet structure on the other end,
     // and allow for some expansion.
     packet << flags;
-    if (flags & NETWORK_TICK_FLAG_CHECKSUMS)
+    if (flags & NETWORK_TICK_FLAG_INCREMENTAL_CHECKSUMS)
+    {
+        EntitiesChecksum checksum = GetAllEntitiesIncrementalChecksum();
+        packet.WriteString(checksum.ToString());
+    }
+    else if (flags & NETWORK_TICK_FLAG_CHECKSUMS)
     {
         EntitiesChecksum checksum = GetAllEntitiesChecksum();
         packet.WriteString(checksum.ToString());
@@ -3082,6 +3146,7 @@ void NetworkBase::Client_Handle_TICK([[maybe_unused]] NetworkConnection& connect
     ServerTickData tickData;
     tickData.srand0 = srand0;
     tickData.tick = serverTick;
+    tickData.spriteHashIsIncremental = (flags & NETWORK_TICK_FLAG_INCREMENTAL_CHECKSUMS) != 0;
 
     if (flags & NETWORK_TICK_FLAG_CHECKSUMS)
     {
@@ -3303,6 +3368,15 @@ void NetworkFlush()
     OpenRCT2::GetContext()->GetNetwork().Flush();
 }
 
+void NetworkInvalidateCachedMaps()
+{
+    auto* context = OpenRCT2::GetContext();
+    if (context != nullptr)
+    {
+        context->GetNetwork().InvalidateCachedMaps();
+    }
+}
+
 int32_t NetworkGetMode()
 {
     return OpenRCT2::GetContext()->GetNetwork().GetMode();
@@ -4102,6 +4176,9 @@ uint32_t NetworkGetServerTick()
 void NetworkFlush()
 {
 }
+void NetworkInvalidateCachedMaps()
+{
+}
 void NetworkSendTick()
 {
 }
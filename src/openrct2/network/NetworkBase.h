@@ -81,6 +81,8 @@ public: // Server
     void ServerClientDisconnected(std::unique_ptr<NetworkConnection>& connection);
     bool SaveMap(OpenRCT2::IStream* stream, const std::vector<const ObjectRepositoryItem*>& objects) const;
     std::vector<uint8_t> SaveForNetwork(const std::vector<const ObjectRepositoryItem*>& objects) const;
+    const std::vector<uint8_t>& GetCachedMapForNetwork(const std::vector<const ObjectRepositoryItem*>& objects);
+    void InvalidateCachedMaps();
     std::string MakePlayerNameUnique(const std::string& name);
 
     // Packet dispatchers.
@@ -206,6 +208,15 @@ private: // Server Data
     uint16_t listening_port = 0;
     bool _playerListInvalidated = false;
 
+    // Saved maps shared by the clients joining on the same tick, one per list of objects sent along.
+    struct CachedMap
+    {
+        std::vector<const ObjectRepositoryItem*> Objects;
+        std::vector<uint8_t> Data;
+    };
+    std::vector<CachedMap> _cachedMaps;
+    uint32_t _cachedMapsTick = 0;
+
 private: // Client Data
     struct PlayerListUpdate
     {
@@ -217,6 +228,7 @@ private: // Client Data
         uint32_t srand0;
         uint32_t tick;
         std::string spriteHash;
+        bool spriteHashIsIncremental;
     };
 
     struct ServerScriptsData
@@ -17,12 +17,15 @@
     #include "Socket.h"
     #include "network.h"
 
+    #include <iterator>
     #include <sfl/small_vector.hpp>
+    #include <span>
 
 using namespace OpenRCT2;
 
 static constexpr size_t kNetworkDisconnectReasonBufSize = 256;
 static constexpr size_t kNetworkBufferSize = (1024 * 64) - 1; // 64 KiB, maximum packet size.
+static constexpr size_t kMaxPacketsPerSend = 64;
     #ifndef DEBUG
 static constexpr size_t kNetworkNoDataTimeout = 20; // Seconds.
     #endif
@@ -103,7 +106,7 @@ NetworkReadPacket NetworkConnection::ReadPacket()
     return NetworkReadPacket::MoreData;
 }
 
-static sfl::small_vector<uint8_t, 512> serializePacket(const NetworkPacket& packet)
+NetworkPacketBuffer NetworkConnection::SerialisePacket(const NetworkPacket& packet)
 {
     // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
     // Previously the Id field was not part of the header rather part of the body.
@@ -116,11 +119,11 @@ static sfl::small_vector<uint8_t, 512> serializePacket(const NetworkPacket& pack
     header.Size = Convert::HostToNetwork(header.Size);
     header.Id = ByteSwapBE(header.Id);
 
-    sfl::small_vector<uint8_t, 512> buffer;
-    buffer.reserve(sizeof(header) + packet.Data.size());
+    auto buffer = std::make_shared<std::vector<uint8_t>>();
+    buffer->reserve(sizeof(header) + packet.Data.size());
 
-    buffer.insert(buffer.end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
-    buffer.insert(buffer.end(), packet.Data.begin(), packet.Data.end());
+    buffer->insert(buffer->end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
+    buffer->insert(buffer->end(), packet.Data.begin(), packet.Data.end());
 
     return buffer;
 }
@@ -129,14 +132,23 @@ void NetworkConnection::QueuePacket(const NetworkPacket& packet, bool front)
 {
     if (AuthStatus == NetworkAuth::Ok || !packet.CommandRequiresAuth())
     {
-        const auto payload = serializePacket(packet);
+        QueuePacket(packet, SerialisePacket(packet), front);
+    }
+}
+
+void NetworkConnection::QueuePacket(const NetworkPacket& packet, const NetworkPacketBuffer& buffer, bool front)
+{
+    if (AuthStatus == NetworkAuth::Ok || !packet.CommandRequiresAuth())
+    {
         if (front)
         {
-            _outboundBuffer.insert(_outboundBuffer.begin(), payload.begin(), payload.end());
+            // Never in front of a packet that has been partly sent.
+            auto it = _outboundOffset > 0 ? std::next(_outboundPackets.begin()) : _outboundPackets.begin();
+            _outboundPackets.insert(it, buffer);
         }
         else
         {
-            _outboundBuffer.insert(_outboundBuffer.end(), payload.begin(), payload.end());
+            _outboundPackets.push_back(buffer);
         }
 
         RecordPacketStats(packet, true);
@@ -155,16 +167,37 @@ bool NetworkConnection::IsValid() const
 
 void NetworkConnection::SendQueuedData()
 {
-    if (_outboundBuffer.empty())
+    while (!_outboundPackets.empty())
     {
-        return;
-    }
+        // Hand the queued packets to the socket in batches, each sent with as few system calls as possible.
+        sfl::small_vector<std::span<const uint8_t>, kMaxPacketsPerSend> buffers;
+        size_t batchSize = 0;
+        for (const auto& packet : _outboundPackets)
+        {
+            if (buffers.size() == kMaxPacketsPerSend)
+                break;
 
-    const auto bytesSent = Socket->SendData(_outboundBuffer.data(), _outboundBuffer.size());
+            const size_t offset = buffers.empty() ? _outboundOffset : 0;
+            buffers.emplace_back(packet->data() + offset, packet->size() - offset);
+            batchSize += packet->size() - offset;
+        }
 
-    if (bytesSent > 0)
-    {
-        _outboundBuffer.erase(_outboundBuffer.begin(), _outboundBuffer.begin() + bytesSent);
+        const auto bytesSent = Socket->SendData(buffers);
+
+        // Drop the packets that have been sent completely.
+        size_t bytesLeft = _outboundOffset + bytesSent;
+        while (!_outboundPackets.empty() && bytesLeft >= _outboundPackets.front()->size())
+        {
+            bytesLeft -= _outboundPackets.front()->size();
+            _outboundPackets.pop_front();
+        }
+        _outboundOffset = bytesLeft;
+
+        if (bytesSent < batchSize)
+        {
+            // Socket buffer is full, try again next update.
+            break;
+        }
     }
 }
 
@@ -16,6 +16,7 @@
     #include "NetworkTypes.h"
     #include "Socket.h"
 
+    #include <deque>
     #include <memory>
     #include <string_view>
     #include <vector>
@@ -23,6 +24,9 @@
 class NetworkPlayer;
 struct ObjectRepositoryItem;
 
+// The bytes of a packet as they are sent, shared by every connection the packet is queued on.
+using NetworkPacketBuffer = std::shared_ptr<const std::vector<uint8_t>>;
+
 class NetworkConnection final
 {
 public:
@@ -41,6 +45,10 @@ public:
 
     NetworkReadPacket ReadPacket();
     void QueuePacket(const NetworkPacket& packet, bool front = false);
+    // Queues a packet serialised with SerialisePacket, so the same packet can be sent to many connections.
+    void QueuePacket(const NetworkPacket& packet, const NetworkPacketBuffer& buffer, bool front = false);
+
+    static NetworkPacketBuffer SerialisePacket(const NetworkPacket& packet);
 
     // This will not immediately disconnect the client. The disconnect
     // will happen post-tick.
@@ -56,7 +64,9 @@ public:
     void SetLastDisconnectReason(const StringId string_id, void* args = nullptr);
 
 private:
-    std::vector<uint8_t> _outboundBuffer;
+    std::deque<NetworkPacketBuffer> _outboundPackets;
+    // Bytes of the first outbound packet that have already been sent.
+    size_t _outboundOffset = 0;
     uint32_t _lastPacketTime = 0;
     std::string _lastDisconnectReason;
 
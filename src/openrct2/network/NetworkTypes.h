@@ -22,6 +22,7 @@ enum
 enum
 {
     NETWORK_TICK_FLAG_CHECKSUMS = 1 << 0,
+    NETWORK_TICK_FLAG_INCREMENTAL_CHECKSUMS = 1 << 1,
 };
 
 enum
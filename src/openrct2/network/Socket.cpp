@@ -11,6 +11,7 @@
 
     #include "../Diagnostic.h"
 
+    #include <algorithm>
     #include <atomic>
     #include <chrono>
     #include <cmath>
@@ -55,6 +56,7 @@
     #include <sys/select.h>
     #include <sys/socket.h>
     #include <sys/time.h>
+    #include <sys/uio.h>
     #include <unistd.h>
 
     using SOCKET = int32_t;
@@ -74,6 +76,7 @@
     #include "Socket.h"
 
 constexpr auto kConnectTimeout = std::chrono::milliseconds(3000);
+constexpr size_t kMaxBuffersPerSend = 64;
 
     // RAII WSA initialisation needed for Windows
     #ifdef _WIN32
@@ -572,6 +575,65 @@ public:
         return totalSent;
     }
 
+    size_t SendData(std::span<const std::span<const uint8_t>> buffers) override
+    {
+        if (_status != SocketStatus::Connected)
+        {
+            throw std::runtime_error("Socket not connected.");
+        }
+
+        size_t totalSent = 0;
+        size_t first = 0;
+        size_t firstOffset = 0;
+        while (first < buffers.size())
+        {
+            const size_t count = std::min(buffers.size() - first, kMaxBuffersPerSend);
+    #ifdef _WIN32
+            WSABUF wsaBuffers[kMaxBuffersPerSend];
+            for (size_t i = 0; i < count; i++)
+            {
+                const auto& buffer = buffers[first + i];
+                const size_t offset = i == 0 ? firstOffset : 0;
+                wsaBuffers[i].buf = reinterpret_cast<CHAR*>(const_cast<uint8_t*>(buffer.data() + offset));
+                wsaBuffers[i].len = static_cast<ULONG>(buffer.size() - offset);
+            }
+            DWORD sentBytes = 0;
+            if (WSASend(_socket, wsaBuffers, static_cast<DWORD>(count), &sentBytes, 0, nullptr, nullptr) == SOCKET_ERROR)
+            {
+                return totalSent;
+            }
+    #else
+            iovec ioBuffers[kMaxBuffersPerSend];
+            for (size_t i = 0; i < count; i++)
+            {
+                const auto& buffer = buffers[first + i];
+                const size_t offset = i == 0 ? firstOffset : 0;
+                ioBuffers[i].iov_base = const_cast<uint8_t*>(buffer.data() + offset);
+                ioBuffers[i].iov_len = buffer.size() - offset;
+            }
+            msghdr message{};
+            message.msg_iov = ioBuffers;
+            message.msg_iovlen = count;
+            const auto sentBytes = sendmsg(_socket, &message, FLAG_NO_PIPE);
+            if (sentBytes == SOCKET_ERROR)
+            {
+                return totalSent;
+            }
+    #endif
+            totalSent += sentBytes;
+
+            // Skip the buffers that were sent completely.
+            size_t bytesLeft = firstOffset + sentBytes;
+            while (first < buffers.size() && bytesLeft >= buffers[first].size())
+            {
+                bytesLeft -= buffers[first].size();
+                first++;
+            }
+            firstOffset = bytesLeft;
+        }
+        return totalSent;
+    }
+
     NetworkReadPacket ReceiveData(void* buffer, size_t size, size_t* sizeReceived) override
     {
         if (_status != SocketStatus::Connected)
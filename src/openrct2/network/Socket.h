@@ -9,7 +9,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -64,6 +66,8 @@ public:
     virtual void ConnectAsync(const std::string& address, uint16_t port) = 0;
 
     virtual size_t SendData(const void* buffer, size_t size) = 0;
+    // Sends the buffers one after the other with as few system calls as possible.
+    virtual size_t SendData(std::span<const std::span<const uint8_t>> buffers) = 0;
     virtual NetworkReadPacket ReceiveData(void* buffer, size_t size, size_t* sizeReceived) = 0;
 
     virtual void SetNoDelay(bool noDelay) = 0;
@@ -51,6 +51,8 @@ bool NetworkGamestateSnapshotsEnabled();
 void NetworkUpdate();
 void NetworkProcessPending();
 void NetworkFlush();
+// Drops the maps saved for joining clients, for changes to the park made without a game action.
+void NetworkInvalidateCachedMaps();
 
 [[nodiscard]] NetworkAuth NetworkGetAuthstatus();
 [[nodiscard]] uint32_t NetworkGetServerTick();
@@ -15,8 +15,8 @@
 #include "../audio/audio.h"
 #include "../core/Console.hpp"
 #include "../core/EnumUtils.hpp"
-#include "../core/JobPool.h"
 #include "../core/Memory.hpp"
+#include "../core/TaskScheduler.h"
 #include "../localisation/StringIds.h"
 #include "../ride/Ride.h"
 #include "../ride/RideAudio.h"
@@ -35,6 +35,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -600,7 +601,7 @@ private:
         objectsToLoad.erase(std::unique(objectsToLoad.begin(), objectsToLoad.end()), objectsToLoad.end());
 
         // Prepare for loading objects multi-threaded
-        auto numProcessed = 0;
+        std::atomic<size_t> numProcessed = 0;
         auto numRequired = objectsToLoad.size();
         std::mutex commonMutex;
         auto loadSingleObject = [&](const ObjectRepositoryItem* requiredObject) {
@@ -624,20 +625,20 @@ private:
             numProcessed++;
         };
 
-        auto completionFn = [&]() {
-            if (reportProgress && (numProcessed % 100) == 0)
+        auto reportFn = [&]() {
+            if (reportProgress)
                 ReportProgress(numProcessed, numRequired);
         };
 
         // Dispatch loading the objects
-        JobPool jobs{};
+        TaskGroup jobs(TaskScheduler::GetShared());
         for (auto* object : objectsToLoad)
         {
-            jobs.AddTask([object, &loadSingleObject]() { loadSingleObject(object); }, completionFn);
+            jobs.Run([object, &loadSingleObject]() { loadSingleObject(object); });
         }
 
         // Wait until all jobs are fully completed
-        jobs.Join();
+        jobs.Wait(reportFn);
 
         // Assign the loaded objects to the required objects
         for (auto& requiredObject : requiredObjects)
@@ -14,6 +14,7 @@
 #include "../core/Guard.hpp"
 #include "../core/Money.hpp"
 #include "../core/Numerics.hpp"
+#include "../core/TaskScheduler.h"
 #include "../drawing/Drawing.h"
 #include "../interface/Viewport.h"
 #include "../localisation/Currency.h"
@@ -24,11 +25,18 @@
 #include "../profiling/Profiling.h"
 #include "Boundbox.h"
 #include "Paint.Entity.h"
+#include "PaintCache.h"
 #include "tile_element/Paint.TileElement.h"
 
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <memory>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_AMD64)
+    #include <emmintrin.h>
+#endif
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Numerics;
@@ -101,6 +109,11 @@ static void PaintSessionAddPSToQuadrant(PaintSession& session, PaintStruct* ps)
 
     session.QuadrantBackIndex = std::min(session.QuadrantBackIndex, paintQuadrantIndex);
     session.QuadrantFrontIndex = std::max(session.QuadrantFrontIndex, paintQuadrantIndex);
+
+    if (session.RecordedStructs != nullptr)
+    {
+        session.RecordedStructs->push_back(ps);
+    }
 }
 
 static constexpr bool ImageWithinDPI(const ScreenCoordsXY& imagePos, const G1Element& g1, const DrawPixelInfo& dpi)
@@ -217,6 +230,135 @@ static PaintStruct* CreateNormalPaintStruct(
     return ps;
 }
 
+static int32_t PaintCacheStoreStruct(PaintCache::Tile& tile, const PaintStruct& ps, bool isInQuadrant)
+{
+    const auto index = static_cast<int32_t>(tile.Structs.size());
+    tile.Structs.push_back({ ps, -1, -1, isInQuadrant });
+
+    int32_t previous = -1;
+    for (const auto* attached = ps.Attached; attached != nullptr; attached = attached->NextEntry)
+    {
+        const auto attachedIndex = static_cast<int32_t>(tile.Attached.size());
+        tile.Attached.push_back({ *attached });
+        if (previous == -1)
+        {
+            tile.Structs[index].FirstAttached = attachedIndex;
+        }
+        else
+        {
+            tile.Attached[previous].Next = attachedIndex;
+        }
+        previous = attachedIndex;
+    }
+
+    if (ps.Children != nullptr)
+    {
+        const auto child = PaintCacheStoreStruct(tile, *ps.Children, false);
+        tile.Structs[index].Child = child;
+    }
+    return index;
+}
+
+// Paints the tile against the whole column of the viewport and stores the paint structs that were added.
+static void PaintSessionRecordTile(
+    PaintSession& session, const PaintCache::Column& column, PaintCache::Tile& tile, const CoordsXY& mapTile)
+{
+    static thread_local std::vector<PaintStruct*> recordedStructs;
+    recordedStructs.clear();
+
+    const auto dpi = session.DPI;
+    session.DPI = column.DPI;
+    session.RecordedStructs = &recordedStructs;
+    TileElementPaintSetup(session, mapTile);
+    session.RecordedStructs = nullptr;
+    session.DPI = dpi;
+
+    for (const auto* ps : recordedStructs)
+    {
+        PaintCacheStoreStruct(tile, *ps, true);
+    }
+}
+
+// Adds copies of the stored paint structs of the tile, to the quadrants in the order they were painted in.
+static void PaintSessionReplayTile(PaintSession& session, const PaintCache::Tile& tile)
+{
+    static thread_local std::vector<PaintStruct*> structs;
+    structs.resize(tile.Structs.size());
+    for (size_t i = 0; i < tile.Structs.size(); i++)
+    {
+        auto* ps = session.AllocateNormalPaintEntry();
+        *ps = tile.Structs[i].Struct;
+        structs[i] = ps;
+    }
+
+    for (size_t i = 0; i < tile.Structs.size(); i++)
+    {
+        const auto& cached = tile.Structs[i];
+        auto* ps = structs[i];
+        ps->Children = cached.Child != -1 ? structs[cached.Child] : nullptr;
+        ps->Attached = nullptr;
+
+        AttachedPaintStruct* previous = nullptr;
+        for (auto index = cached.FirstAttached; index != -1; index = tile.Attached[index].Next)
+        {
+            auto* attached = session.AllocateAttachedPaintEntry();
+            *attached = tile.Attached[index].Struct;
+            attached->NextEntry = nullptr;
+            if (previous == nullptr)
+            {
+                ps->Attached = attached;
+            }
+            else
+            {
+                previous->NextEntry = attached;
+            }
+            previous = attached;
+        }
+
+        if (cached.IsInQuadrant)
+        {
+            PaintSessionAddPSToQuadrant(session, ps);
+        }
+    }
+
+    session.LastPS = nullptr;
+    session.LastAttachedPS = nullptr;
+}
+
+static void PaintSessionTileSetup(PaintSession& session, const CoordsXY& mapTile)
+{
+    auto* column = session.CacheColumn;
+    if (column == nullptr)
+    {
+        TileElementPaintSetup(session, mapTile);
+        return;
+    }
+
+    // Cached tiles can not attach their images to the paint structs painted before them.
+    session.LastPS = nullptr;
+    session.LastAttachedPS = nullptr;
+
+    auto* tile = PaintCache::Find(*column, mapTile);
+    if (tile == nullptr)
+    {
+        tile = &PaintCache::Store(*column, mapTile);
+        if (tile->IsCacheable)
+        {
+            PaintSessionRecordTile(session, *column, *tile, mapTile);
+            return;
+        }
+    }
+
+    if (tile->IsCacheable)
+    {
+        PaintSessionReplayTile(session, *tile);
+    }
+    else
+    {
+        TileElementPaintSetup(session, mapTile);
+    }
+}
+
 template<uint8_t direction>
 void PaintSessionGenerateRotate(PaintSession& session)
 {
@@ -243,14 +385,14 @@ void PaintSessionGenerateRotate(PaintSession& session)
 
     for (; numVerticalTiles > 0; --numVerticalTiles)
     {
-        TileElementPaintSetup(session, mapTile);
+        PaintSessionTileSetup(session, mapTile);
         EntityPaintSetup(session, mapTile);
 
         const auto loc1 = mapTile + adjacentTiles[0];
         EntityPaintSetup(session, loc1);
 
         const auto loc2 = mapTile + adjacentTiles[1];
-        TileElementPaintSetup(session, loc2);
+        PaintSessionTileSetup(session, loc2);
         EntityPaintSetup(session, loc2);
 
         const auto loc3 = mapTile + adjacentTiles[2];
@@ -619,13 +761,372 @@ constexpr std::array _paintArrangeFuncsStable = {
     PaintSessionArrangeImpl<true, 3>,
 };
 
+// The paint structs of a session in the order of the quadrant lists, with the bounds and the sort state of each
+// struct kept in separate arrays so the bounding box tests against a struct run over contiguous memory.
+struct PaintSortArrays
+{
+    std::vector<PaintStruct*> Structs;
+    std::vector<int32_t> X;
+    std::vector<int32_t> Y;
+    std::vector<int32_t> Z;
+    std::vector<int32_t> XEnd;
+    std::vector<int32_t> YEnd;
+    std::vector<int32_t> ZEnd;
+    std::vector<uint16_t> QuadrantIndex;
+    std::vector<uint8_t> SortFlags;
+
+    void Resize(size_t count)
+    {
+        Structs.resize(count);
+        X.resize(count);
+        Y.resize(count);
+        Z.resize(count);
+        XEnd.resize(count);
+        YEnd.resize(count);
+        ZEnd.resize(count);
+        QuadrantIndex.resize(count);
+        SortFlags.resize(count);
+    }
+
+    void Set(size_t index, PaintStruct* ps)
+    {
+        Structs[index] = ps;
+        X[index] = ps->Bounds.x;
+        Y[index] = ps->Bounds.y;
+        Z[index] = ps->Bounds.z;
+        XEnd[index] = ps->Bounds.x_end;
+        YEnd[index] = ps->Bounds.y_end;
+        ZEnd[index] = ps->Bounds.z_end;
+        QuadrantIndex[index] = ps->QuadrantIndex;
+        SortFlags[index] = PaintSortFlags::None;
+    }
+};
+
+// A run of quadrants that is sorted without looking at the structs of any other run.
+struct PaintSortRange
+{
+    PaintSortArrays* Arrays;
+    size_t First;
+    size_t Last;
+    uint32_t QuadrantFirst;
+    uint32_t QuadrantLast;
+    uint8_t Flag;
+};
+
+// Only split the sort when each range has enough structs to be worth a task.
+static constexpr size_t kMinStructsPerSortRange = 512;
+
+// Scratch space of a thread arranging a session, kept between frames. Waiting for the sort tasks can run the arrange of
+// another column on the same thread, so every nested arrange takes its own from the thread's free list.
+struct PaintArrangeScratch
+{
+    PaintSortArrays Arrays;
+    std::vector<PaintSortRange> Ranges;
+};
+static thread_local std::vector<std::unique_ptr<PaintArrangeScratch>> _freeArrangeScratch;
+
+// Scratch space of the thread sorting a range.
+struct PaintSortScratch
+{
+    std::vector<uint8_t> Moves;
+    std::vector<uint32_t> Order;
+    std::vector<PaintStruct*> Structs;
+    std::vector<int32_t> Bounds;
+    std::vector<uint16_t> QuadrantIndex;
+    std::vector<uint8_t> SortFlags;
+};
+
+// Same test as CheckBoundingBox. Each rotation only swaps the direction of the x and y tests, which is done by flipping
+// their results, so the comparisons are the same for every rotation and four structs are tested at once where SSE2 is
+// available. Sets moves[i - first] for every neighbour from first to last that has to be drawn before the child.
+template<uint8_t TRotation>
+static size_t PaintSortTestBoundingBoxes(
+    const PaintSortArrays& arrays, size_t child, size_t first, size_t last, uint8_t* moves)
+{
+    constexpr bool kFlipX = TRotation == 1 || TRotation == 2;
+    constexpr bool kFlipY = TRotation == 2 || TRotation == 3;
+
+    const int32_t x = arrays.X[child];
+    const int32_t y = arrays.Y[child];
+    const int32_t z = arrays.Z[child];
+    const int32_t xEnd = arrays.XEnd[child];
+    const int32_t yEnd = arrays.YEnd[child];
+    const int32_t zEnd = arrays.ZEnd[child];
+    const int32_t* otherX = arrays.X.data();
+    const int32_t* otherY = arrays.Y.data();
+    const int32_t* otherZ = arrays.Z.data();
+    const int32_t* otherXEnd = arrays.XEnd.data();
+    const int32_t* otherYEnd = arrays.YEnd.data();
+    const int32_t* otherZEnd = arrays.ZEnd.data();
+    const uint8_t* sortFlags = arrays.SortFlags.data();
+
+    size_t numMoves = 0;
+    size_t i = first;
+#if defined(__SSE2__) || defined(_M_AMD64)
+    const __m128i flipX = _mm_set1_epi32(kFlipX ? -1 : 0);
+    const __m128i flipY = _mm_set1_epi32(kFlipY ? -1 : 0);
+    const __m128i x4 = _mm_set1_epi32(x);
+    const __m128i y4 = _mm_set1_epi32(y);
+    const __m128i z4 = _mm_set1_epi32(z);
+    const __m128i xEnd4 = _mm_set1_epi32(xEnd);
+    const __m128i yEnd4 = _mm_set1_epi32(yEnd);
+    const __m128i zEnd4 = _mm_set1_epi32(zEnd);
+    const auto load = [](const int32_t* values, size_t index) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index));
+    };
+    for (; i + 4 <= last; i += 4)
+    {
+        const __m128i notBehind = _mm_or_si128(
+            _mm_cmpgt_epi32(load(otherZ, i), zEnd4),
+            _mm_or_si128(
+                _mm_xor_si128(_mm_cmpgt_epi32(load(otherY, i), yEnd4), flipY),
+                _mm_xor_si128(_mm_cmpgt_epi32(load(otherX, i), xEnd4), flipX)));
+        const __m128i overlaps = _mm_and_si128(
+            _mm_cmpgt_epi32(load(otherZEnd, i), z4),
+            _mm_and_si128(
+                _mm_xor_si128(_mm_cmpgt_epi32(load(otherYEnd, i), y4), flipY),
+                _mm_xor_si128(_mm_cmpgt_epi32(load(otherXEnd, i), x4), flipX)));
+        const int32_t mask = ~_mm_movemask_ps(_mm_castsi128_ps(_mm_or_si128(notBehind, overlaps)));
+        for (size_t j = 0; j < 4; j++)
+        {
+            const bool isNeighbour = (sortFlags[i + j] & PaintSortFlags::Neighbour) != 0;
+            const uint8_t move = ((mask >> j) & 1) & isNeighbour;
+            moves[i + j - first] = move;
+            numMoves += move;
+        }
+    }
+#endif
+    for (; i < last; i++)
+    {
+        const bool behind = !((otherZ[i] > zEnd) | ((otherY[i] > yEnd) != kFlipY) | ((otherX[i] > xEnd) != kFlipX));
+        const bool overlaps = (otherZEnd[i] > z) & ((otherYEnd[i] > y) != kFlipY) & ((otherXEnd[i] > x) != kFlipX);
+        const bool isNeighbour = (sortFlags[i] & PaintSortFlags::Neighbour) != 0;
+        const uint8_t move = behind & !overlaps & isNeighbour;
+        moves[i - first] = move;
+        numMoves += move;
+    }
+    return numMoves;
+}
+
+template<typename T>
+static void PaintSortPermute(std::vector<T>& values, size_t first, const std::vector<uint32_t>& order, std::vector<T>& scratch)
+{
+    scratch.assign(values.begin() + first, values.begin() + first + order.size());
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        values[first + i] = scratch[order[i]];
+    }
+}
+
+// Moves the structs flagged in moves in front of the others from first to last, keeping the order within both.
+static void PaintSortMoveToFront(PaintSortArrays& arrays, size_t first, size_t last, PaintSortScratch& scratch)
+{
+    const auto* moves = scratch.Moves.data();
+    auto& order = scratch.Order;
+    order.clear();
+    for (size_t i = first; i < last; i++)
+    {
+        if (moves[i - first])
+            order.push_back(static_cast<uint32_t>(i - first));
+    }
+    for (size_t i = first; i < last; i++)
+    {
+        if (!moves[i - first])
+            order.push_back(static_cast<uint32_t>(i - first));
+    }
+
+    PaintSortPermute(arrays.Structs, first, order, scratch.Structs);
+    PaintSortPermute(arrays.X, first, order, scratch.Bounds);
+    PaintSortPermute(arrays.Y, first, order, scratch.Bounds);
+    PaintSortPermute(arrays.Z, first, order, scratch.Bounds);
+    PaintSortPermute(arrays.XEnd, first, order, scratch.Bounds);
+    PaintSortPermute(arrays.YEnd, first, order, scratch.Bounds);
+    PaintSortPermute(arrays.ZEnd, first, order, scratch.Bounds);
+    PaintSortPermute(arrays.QuadrantIndex, first, order, scratch.QuadrantIndex);
+    PaintSortPermute(arrays.SortFlags, first, order, scratch.SortFlags);
+}
+
+// Does the same steps as PaintArrangeStructsHelperRotation with the stable sort, for each quadrant of the range.
+// The window of a quadrant starts at the first struct of the quadrant and ends before the first struct past its
+// neighbour, where the linked version marks the struct as outside of the quadrant.
+template<uint8_t TRotation>
+static void PaintSortQuadrantRange(const PaintSortRange& range)
+{
+    thread_local PaintSortScratch scratch;
+
+    auto& arrays = *range.Arrays;
+    auto& quadrantIndices = arrays.QuadrantIndex;
+    auto& sortFlags = arrays.SortFlags;
+    auto& moves = scratch.Moves;
+
+    uint8_t flag = range.Flag;
+    size_t start = range.First;
+    for (uint32_t quadrantIndex = range.QuadrantFirst; quadrantIndex <= range.QuadrantLast; quadrantIndex++)
+    {
+        while (start < range.Last && quadrantIndices[start] < quadrantIndex)
+        {
+            start++;
+        }
+
+        size_t end = start;
+        for (; end < range.Last; end++)
+        {
+            const uint32_t structQuadrant = quadrantIndices[end];
+            if (structQuadrant > quadrantIndex + 1)
+            {
+                break;
+            }
+            if (structQuadrant == quadrantIndex + 1)
+            {
+                sortFlags[end] = PaintSortFlags::Neighbour | PaintSortFlags::PendingVisit;
+            }
+            else if (structQuadrant == quadrantIndex)
+            {
+                sortFlags[end] = flag | PaintSortFlags::PendingVisit;
+            }
+        }
+
+        if (moves.size() < end - start)
+        {
+            moves.resize(end - start);
+        }
+        for (size_t child = start;;)
+        {
+            while (child < end && !(sortFlags[child] & PaintSortFlags::PendingVisit))
+            {
+                child++;
+            }
+            if (child == end)
+            {
+                break;
+            }
+
+            sortFlags[child] &= ~PaintSortFlags::PendingVisit;
+
+            // The structs that move end up in front of the child, the next pending struct is searched from there.
+            // Nothing after the last struct that moves changes place.
+            if (PaintSortTestBoundingBoxes<TRotation>(arrays, child, child + 1, end, moves.data() + 1) > 0)
+            {
+                moves[0] = 0;
+                size_t movesEnd = end;
+                while (!moves[movesEnd - 1 - child])
+                {
+                    movesEnd--;
+                }
+                PaintSortMoveToFront(arrays, child, movesEnd, scratch);
+            }
+        }
+
+        flag = PaintSortFlags::None;
+    }
+}
+
+// Produces the same order as PaintSessionArrangeImpl with the stable sort. A quadrant with no structs separates the
+// quadrants before it from the ones after it: the window of the quadrant before it ends at the first struct after
+// it, and no struct in front of it is in any later window. Those ranges are sorted concurrently when jobs is given.
+template<uint8_t TRotation>
+static void PaintSessionArrangeArray(PaintSessionCore& session, TaskScheduler* jobs)
+{
+    const uint32_t quadrantBack = session.QuadrantBackIndex;
+    if (quadrantBack == UINT32_MAX)
+    {
+        return;
+    }
+    const uint32_t quadrantFront = session.QuadrantFrontIndex;
+
+    size_t count = 0;
+    for (uint32_t quadrantIndex = quadrantBack; quadrantIndex <= quadrantFront; quadrantIndex++)
+    {
+        for (auto* ps = session.Quadrants[quadrantIndex]; ps != nullptr; ps = ps->NextQuadrantEntry)
+        {
+            count++;
+        }
+    }
+
+    std::unique_ptr<PaintArrangeScratch> scratch;
+    if (_freeArrangeScratch.empty())
+    {
+        scratch = std::make_unique<PaintArrangeScratch>();
+    }
+    else
+    {
+        scratch = std::move(_freeArrangeScratch.back());
+        _freeArrangeScratch.pop_back();
+    }
+
+    auto& arrays = scratch->Arrays;
+    arrays.Resize(count);
+
+    auto& ranges = scratch->Ranges;
+    ranges.clear();
+    ranges.push_back({ &arrays, 0, count, quadrantBack, 0, PaintSortFlags::Neighbour });
+
+    size_t index = 0;
+    for (uint32_t quadrantIndex = quadrantBack; quadrantIndex <= quadrantFront; quadrantIndex++)
+    {
+        auto* ps = session.Quadrants[quadrantIndex];
+        if (ps == nullptr && jobs != nullptr && count - index >= kMinStructsPerSortRange
+            && index - ranges.back().First >= kMinStructsPerSortRange)
+        {
+            ranges.back().Last = index;
+            ranges.back().QuadrantLast = quadrantIndex - 1;
+            ranges.push_back({ &arrays, index, count, quadrantIndex, 0, PaintSortFlags::None });
+        }
+        for (; ps != nullptr; ps = ps->NextQuadrantEntry)
+        {
+            arrays.Set(index++, ps);
+        }
+    }
+    ranges.back().QuadrantLast = quadrantFront > quadrantBack ? quadrantFront - 1 : quadrantBack;
+
+    if (ranges.size() > 1)
+    {
+        TaskGroup group(*jobs);
+        for (const auto& range : ranges)
+        {
+            const auto* rangePtr = &range;
+            group.Run([rangePtr]() { PaintSortQuadrantRange<TRotation>(*rangePtr); });
+        }
+        group.Wait();
+    }
+    else
+    {
+        PaintSortQuadrantRange<TRotation>(ranges.front());
+    }
+
+    for (size_t i = 0; i + 1 < count; i++)
+    {
+        arrays.Structs[i]->NextQuadrantEntry = arrays.Structs[i + 1];
+    }
+    if (count > 0)
+    {
+        arrays.Structs[count - 1]->NextQuadrantEntry = nullptr;
+        session.PaintHead = arrays.Structs[0];
+    }
+
+    _freeArrangeScratch.push_back(std::move(scratch));
+}
+
+using PaintArrangeArrayWithRotation = void (*)(PaintSessionCore& session, TaskScheduler* jobs);
+
+constexpr std::array<PaintArrangeArrayWithRotation, 4> _paintArrangeFuncsArray = {
+    PaintSessionArrangeArray<0>,
+    PaintSessionArrangeArray<1>,
+    PaintSessionArrangeArray<2>,
+    PaintSessionArrangeArray<3>,
+};
+
 /**
  *
  *  rct2: 0x00688217
  */
-void PaintSessionArrange(PaintSessionCore& session)
+void PaintSessionArrange(PaintSessionCore& session, TaskScheduler* jobs)
 {
     PROFILED_FUNCTION();
+    if (Config::Get().general.ArrayPaintSort)
+    {
+        return _paintArrangeFuncsArray[session.CurrentRotation](session, jobs);
+    }
     if (gPaintStableSort)
     {
         return _paintArrangeFuncsStable[session.CurrentRotation](session);
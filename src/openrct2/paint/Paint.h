@@ -21,6 +21,7 @@
 #include <sfl/segmented_vector.hpp>
 #include <sfl/static_vector.hpp>
 #include <thread>
+#include <vector>
 
 struct EntityBase;
 struct TileElement;
@@ -28,6 +29,16 @@ struct SurfaceElement;
 enum class RailingEntrySupportType : uint8_t;
 enum class ViewportInteractionItem : uint8_t;
 
+namespace OpenRCT2
+{
+    class TaskScheduler;
+}
+
+namespace OpenRCT2::PaintCache
+{
+    struct Column;
+}
+
 struct AttachedPaintStruct
 {
     AttachedPaintStruct* NextEntry;
@@ -194,6 +205,12 @@ struct PaintSession : public PaintSessionCore
     DrawPixelInfo DPI;
     PaintNodeStorage paintEntries;
 
+    // The cached tiles of the viewport column, if the paint cache is enabled.
+    OpenRCT2::PaintCache::Column* CacheColumn;
+
+    // Collects the paint structs added to the quadrants while a tile is recorded for the paint cache.
+    std::vector<PaintStruct*>* RecordedStructs;
+
     PaintStruct* AllocateNormalPaintEntry() noexcept
     {
         auto* entry = paintEntries.allocate();
@@ -307,6 +324,8 @@ void PaintFloatingMoneyEffect(
 PaintSession* PaintSessionAlloc(DrawPixelInfo& dpi, uint32_t viewFlags, uint8_t rotation);
 void PaintSessionFree(PaintSession* session);
 void PaintSessionGenerate(PaintSession& session);
-void PaintSessionArrange(PaintSessionCore& session);
+// Sorts the paint structs into drawing order. With the array sort turned on and a scheduler given, the independent
+// quadrant ranges of the session are sorted concurrently on it.
+void PaintSessionArrange(PaintSessionCore& session, OpenRCT2::TaskScheduler* jobs = nullptr);
 void PaintDrawStructs(PaintSession& session);
 void PaintDrawMoneyStructs(DrawPixelInfo& dpi, PaintStringStruct* ps);
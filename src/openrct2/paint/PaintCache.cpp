@@ -0,0 +1,259 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "PaintCache.h"
+
+#include "../OpenRCT2.h"
+#include "../config/Config.h"
+#include "../core/EnumUtils.hpp"
+#include "../entity/PatrolArea.h"
+#include "../object/LargeSceneryEntry.h"
+#include "../object/SmallSceneryEntry.h"
+#include "../object/WallSceneryEntry.h"
+#include "../ride/TrackDesign.h"
+#include "../world/Banner.h"
+#include "../world/Map.h"
+#include "../world/TileInspector.h"
+#include "../world/tile_element/LargeSceneryElement.h"
+#include "../world/tile_element/PathElement.h"
+#include "../world/tile_element/SmallSceneryElement.h"
+#include "../world/tile_element/TileElement.h"
+#include "../world/tile_element/WallElement.h"
+#include "VirtualFloor.h"
+#include "tile_element/Paint.TileElement.h"
+
+#include <algorithm>
+#include <optional>
+#include <variant>
+
+namespace OpenRCT2::PaintCache
+{
+    // Enough for a few viewports the size of a 4K screen, the frame count does not advance when rendering without a
+    // window.
+    static constexpr size_t kMaxColumns = 1024;
+
+    struct ColumnKey
+    {
+        int32_t X;
+        int32_t Y;
+        int32_t Width;
+        int32_t Height;
+        int8_t Zoom;
+        uint8_t Rotation;
+        uint32_t ViewFlags;
+
+        bool operator==(const ColumnKey&) const = default;
+    };
+
+    struct ColumnKeyHash
+    {
+        size_t operator()(const ColumnKey& key) const
+        {
+            auto hash = std::hash<int64_t>{}((static_cast<int64_t>(key.X) << 32) ^ key.Y);
+            hash ^= std::hash<int64_t>{}((static_cast<int64_t>(key.Width) << 32) ^ key.Height) + 0x9E3779B9 + (hash << 6);
+            hash ^= std::hash<uint32_t>{}(key.ViewFlags ^ (key.Zoom << 24) ^ (key.Rotation << 28)) + 0x9E3779B9 + (hash << 6);
+            return hash;
+        }
+    };
+
+    static std::unordered_map<ColumnKey, Column, ColumnKeyHash> _columns;
+
+    // The revision each tile was last invalidated at, a cached tile is valid while it was stored at or after it.
+    static std::vector<uint32_t> _tileRevisions;
+    static uint32_t _revision = 1;
+
+    bool IsEnabled()
+    {
+        return Config::Get().general.CachePaintColumns && !gTrackDesignSaveMode && !gShowSupportSegmentHeights
+            && !VirtualFloorIsEnabled() && !(gMapSelectFlags & MAP_SELECT_FLAG_ENABLE_CONSTRUCT);
+    }
+
+    static uint64_t Mix(uint64_t hash, uint64_t value)
+    {
+        return (hash ^ value) * 0x100000001B3uLL;
+    }
+
+    // Everything outside the tile elements and the view that changes the paint structs of the tiles.
+    static uint64_t GetState()
+    {
+        uint64_t state = 0xCBF29CE484222325uLL;
+        state = Mix(state, gScreenFlags);
+        state = Mix(state, gClipHeight);
+        state = Mix(state, (static_cast<uint64_t>(gClipSelectionA.x) << 32) | static_cast<uint32_t>(gClipSelectionA.y));
+        state = Mix(state, (static_cast<uint64_t>(gClipSelectionB.x) << 32) | static_cast<uint32_t>(gClipSelectionB.y));
+        state = Mix(state, gMapSelectFlags | (gMapSelectType << 16));
+        state = Mix(state, (static_cast<uint64_t>(gMapSelectPositionA.x) << 32) | static_cast<uint32_t>(gMapSelectPositionA.y));
+        state = Mix(state, (static_cast<uint64_t>(gMapSelectPositionB.x) << 32) | static_cast<uint32_t>(gMapSelectPositionB.y));
+        state = Mix(
+            state, (static_cast<uint64_t>(gMapSelectArrowPosition.x) << 32) | static_cast<uint32_t>(gMapSelectArrowPosition.y));
+        state = Mix(state, gMapSelectArrowPosition.z | (gMapSelectArrowDirection << 24));
+        state = Mix(state, gPaintWidePathsAsGhost | (gPaintBlockedTiles << 1));
+        state = Mix(state, reinterpret_cast<uintptr_t>(TileInspector::GetSelectedElement()));
+
+        const auto patrolArea = GetPatrolAreaToRender();
+        state = Mix(state, patrolArea.index());
+        if (const auto* staffType = std::get_if<StaffType>(&patrolArea))
+        {
+            state = Mix(state, EnumValue(*staffType));
+        }
+        else if (const auto* staffId = std::get_if<EntityId>(&patrolArea))
+        {
+            state = Mix(state, staffId->ToUnderlying());
+        }
+        return state;
+    }
+
+    void Trim()
+    {
+        std::erase_if(_columns, [](const auto& item) { return gCurrentDrawCount - item.second.LastDrawCount > 1; });
+        if (_columns.size() > kMaxColumns)
+        {
+            _columns.clear();
+        }
+    }
+
+    Column* GetColumn(const DrawPixelInfo& columnDpi, uint32_t viewFlags, uint8_t rotation)
+    {
+        if (_tileRevisions.empty())
+        {
+            _tileRevisions.resize(kMaximumMapSizeTechnical * kMaximumMapSizeTechnical);
+        }
+
+        ColumnKey key{};
+        key.X = columnDpi.x;
+        key.Y = columnDpi.y;
+        key.Width = columnDpi.width;
+        key.Height = columnDpi.height;
+        key.Zoom = static_cast<int8_t>(columnDpi.zoom_level);
+        key.Rotation = rotation;
+        key.ViewFlags = viewFlags;
+
+        auto& column = _columns[key];
+        const auto state = GetState();
+        if (column.State != state)
+        {
+            column.Tiles.clear();
+            column.State = state;
+        }
+        column.DPI = columnDpi;
+        column.LastDrawCount = gCurrentDrawCount;
+        return &column;
+    }
+
+    static std::optional<uint32_t> GetTileIndex(const CoordsXY& loc)
+    {
+        const auto tile = TileCoordsXY(loc);
+        if (loc.x < 0 || loc.y < 0 || tile.x >= kMaximumMapSizeTechnical || tile.y >= kMaximumMapSizeTechnical)
+            return std::nullopt;
+        return tile.y * kMaximumMapSizeTechnical + tile.x;
+    }
+
+    static bool IsElementCacheable(const TileElement& element)
+    {
+        switch (element.GetType())
+        {
+            case TileElementType::Surface:
+                return true;
+            case TileElementType::Path:
+                // Queues show the state of their ride on their banners and TVs.
+                return !element.AsPath()->IsQueue();
+            case TileElementType::SmallScenery:
+            {
+                const auto* entry = element.AsSmallScenery()->GetEntry();
+                return entry == nullptr || !entry->HasFlag(SMALL_SCENERY_FLAG_ANIMATED);
+            }
+            case TileElementType::LargeScenery:
+            {
+                const auto* entry = element.AsLargeScenery()->GetEntry();
+                return entry == nullptr || entry->scrolling_mode == SCROLLING_MODE_NONE;
+            }
+            case TileElementType::Wall:
+            {
+                const auto* entry = element.AsWall()->GetEntry();
+                return entry == nullptr
+                    || (entry->scrolling_mode == SCROLLING_MODE_NONE && !(entry->flags & WALL_SCENERY_IS_DOOR)
+                        && !(entry->flags2 & WALL_SCENERY_2_ANIMATED));
+            }
+            default:
+                // Track pieces paint the vehicles of flat rides, entrances and banners animate or scroll their text.
+                return false;
+        }
+    }
+
+    static bool IsTileCacheable(const CoordsXY& loc)
+    {
+        const auto* element = MapGetFirstElementAt(loc);
+        if (element == nullptr)
+            return true;
+
+        do
+        {
+            if (!IsElementCacheable(*element))
+                return false;
+        } while (!(element++)->IsLastForTile());
+        return true;
+    }
+
+    Tile* Find(Column& column, const CoordsXY& loc)
+    {
+        const auto index = GetTileIndex(loc);
+        if (!index.has_value())
+            return nullptr;
+
+        auto it = column.Tiles.find(*index);
+        if (it == column.Tiles.end() || it->second.Revision < _tileRevisions[*index])
+            return nullptr;
+        return &it->second;
+    }
+
+    Tile& Store(Column& column, const CoordsXY& loc)
+    {
+        // Tiles outside the map are painted every time, under a key no tile on the map uses.
+        const auto index = GetTileIndex(loc);
+        auto& tile = column.Tiles[index.value_or(UINT32_MAX)];
+        tile.Revision = _revision;
+        tile.IsCacheable = index.has_value() && IsTileCacheable(loc);
+        tile.Structs.clear();
+        tile.Attached.clear();
+        return tile;
+    }
+
+    void Invalidate(const CoordsXY& loc)
+    {
+        Invalidate(loc, loc);
+    }
+
+    void Invalidate(const CoordsXY& mins, const CoordsXY& maxs)
+    {
+        if (_tileRevisions.empty())
+            return;
+
+        // The edges of a surface depend on the surfaces next to it.
+        const auto minTile = TileCoordsXY(mins);
+        const auto maxTile = TileCoordsXY(maxs);
+        const auto minX = std::max(std::min(minTile.x, maxTile.x) - 1, 0);
+        const auto minY = std::max(std::min(minTile.y, maxTile.y) - 1, 0);
+        const auto maxX = std::min(std::max(minTile.x, maxTile.x) + 1, kMaximumMapSizeTechnical - 1);
+        const auto maxY = std::min(std::max(minTile.y, maxTile.y) + 1, kMaximumMapSizeTechnical - 1);
+
+        _revision++;
+        for (auto y = minY; y <= maxY; y++)
+        {
+            for (auto x = minX; x <= maxX; x++)
+            {
+                _tileRevisions[y * kMaximumMapSizeTechnical + x] = _revision;
+            }
+        }
+    }
+
+    void Invalidate()
+    {
+        _columns.clear();
+    }
+} // namespace OpenRCT2::PaintCache
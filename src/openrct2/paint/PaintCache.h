@@ -0,0 +1,82 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../drawing/Drawing.h"
+#include "../world/Location.hpp"
+#include "Paint.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Cache of the paint structs generated for the tile elements of each viewport column, so a viewport that does not
+ * move only generates the paint structs of the entities and of the tiles that changed since the previous frame.
+ *
+ * The tiles of a column are painted against the whole column of the viewport, regardless of the part of it that is
+ * redrawn, and replayed between the entities in the same order as they were generated. Tiles with elements that are
+ * animated or depend on the state of a ride are never cached. Cached tiles are dropped when the map invalidates them,
+ * every column is dropped when the tile elements move in memory or the whole screen is invalidated, and columns that
+ * have scrolled out of view are dropped a frame later.
+ */
+namespace OpenRCT2::PaintCache
+{
+    // A paint struct of a cached tile, with the links to its child and attached structs as indices into the tile.
+    struct CachedStruct
+    {
+        PaintStruct Struct;
+        int32_t Child = -1;
+        int32_t FirstAttached = -1;
+        bool IsInQuadrant{};
+    };
+
+    struct CachedAttached
+    {
+        AttachedPaintStruct Struct;
+        int32_t Next = -1;
+    };
+
+    struct Tile
+    {
+        uint32_t Revision{};
+        bool IsCacheable{};
+        std::vector<CachedStruct> Structs;
+        std::vector<CachedAttached> Attached;
+    };
+
+    struct Column
+    {
+        // The whole column of the viewport, which the paint structs of the cached tiles are culled against.
+        DrawPixelInfo DPI;
+        uint64_t State{};
+        // The frame the column was last painted in.
+        uint32_t LastDrawCount{};
+        std::unordered_map<uint32_t, Tile> Tiles;
+    };
+
+    // Whether the cache is turned on and nothing that changes the paint structs of the tiles every frame is shown.
+    bool IsEnabled();
+
+    // Drops the columns that were not painted in this frame or the previous one, must not be called while the columns
+    // are being painted.
+    void Trim();
+
+    Column* GetColumn(const DrawPixelInfo& columnDpi, uint32_t viewFlags, uint8_t rotation);
+
+    // Returns the tile if it was stored since the last time it was invalidated.
+    Tile* Find(Column& column, const CoordsXY& loc);
+    Tile& Store(Column& column, const CoordsXY& loc);
+
+    // Drops the cached tiles around a changed tile, the tiles of a region, or every column.
+    void Invalidate(const CoordsXY& loc);
+    void Invalidate(const CoordsXY& mins, const CoordsXY& maxs);
+    void Invalidate();
+} // namespace OpenRCT2::PaintCache
@@ -182,6 +182,8 @@ PaintSession* Painter::CreateSession(DrawPixelInfo& dpi, uint32_t viewFlags, uin
     session->CurrentlyDrawnTileElement = nullptr;
     session->Surface = nullptr;
     session->SelectedElement = OpenRCT2::TileInspector::GetSelectedElement();
+    session->CacheColumn = nullptr;
+    session->RecordedStructs = nullptr;
 
     return session;
 }
@@ -17,6 +17,7 @@
 #include "../OpenRCT2.h"
 #include "../ParkImporter.h"
 #include "../Version.h"
+#include "../config/Config.h"
 #include "../core/Console.hpp"
 #include "../core/Crypt.h"
 #include "../core/DataSerialiser.h"
@@ -66,6 +67,8 @@
 #include <cassert>
 #include <cstdint>
 #include <ctime>
+#include <functional>
+#include <memory>
 #include <numeric>
 #include <optional>
 #include <string_view>
@@ -177,11 +180,37 @@ namespace OpenRCT2
         void Save(GameState_t& gameState, IStream& stream)
         {
             OrcaStream os(stream, OrcaStream::Mode::WRITING);
+            WriteChunks(gameState, os);
+        }
+
+        void Save(GameState_t& gameState, const std::string_view path)
+        {
+            FileStream fs(path, FILE_MODE_WRITE);
+            Save(gameState, fs);
+        }
 
+        // Writes the park to memory, leaving the compression and writing to the image.
+        OrcaStream::Image Capture(GameState_t& gameState)
+        {
+            OrcaStream os;
+            WriteChunks(gameState, os);
+            return os.TakeImage();
+        }
+
+    private:
+        void WriteChunks(GameState_t& gameState, OrcaStream& os)
+        {
             auto& header = os.GetHeader();
             header.Magic = kParkFileMagic;
-            header.TargetVersion = kParkFileCurrentVersion;
+            header.TargetVersion = kParkFileGzipVersion;
             header.MinVersion = kParkFileMinVersion;
+            if (Config::Get().general.ParallelParkCompression)
+            {
+                // Older versions cannot read the block compressed payload.
+                header.Compression = OrcaStream::CompressionType::gzipBlocks;
+                header.TargetVersion = kBlockCompressionVersion;
+                header.MinVersion = kBlockCompressionVersion;
+            }
 
             ReadWriteAuthoringChunk(os);
             ReadWriteObjectsChunk(os);
@@ -202,12 +231,7 @@ namespace OpenRCT2
             ReadWritePackedObjectsChunk(os);
         }
 
-        void Save(GameState_t& gameState, const std::string_view path)
-        {
-            FileStream fs(path, FILE_MODE_WRITE);
-            Save(gameState, fs);
-        }
-
+    public:
         ScenarioIndexEntry ReadScenarioChunk()
         {
             ScenarioIndexEntry entry{};
@@ -566,6 +590,11 @@ namespace OpenRCT2
                 cs.ReadWrite(gameState.WidePathTileLoopPosition);
 
                 auto& rideRatings = gameState.RideRatingUpdateStates;
+                if (os.GetMode() == OrcaStream::Mode::WRITING)
+                {
+                    // Cached walks only exist in this session, save the states a real walk would be in.
+                    RideRatingsFlushCachedWalks();
+                }
                 if (os.GetHeader().TargetVersion >= 21)
                 {
                     cs.ReadWriteArray(rideRatings, [this, &cs](RideRatingUpdateState& calcData) {
@@ -2629,7 +2658,8 @@ enum : uint32_t
     S6_SAVE_FLAG_AUTOMATIC = 1u << 31,
 };
 
-int32_t ScenarioSave(GameState_t& gameState, u8string_view path, int32_t flags)
+// Captures the park into an image that can be written to the file later, shows an error and returns nullptr on failure.
+static std::shared_ptr<OrcaStream::Image> ScenarioSaveCapture(GameState_t& gameState, int32_t flags)
 {
     if (flags & S6_SAVE_FLAG_SCENARIO)
     {
@@ -2649,7 +2679,6 @@ int32_t ScenarioSave(GameState_t& gameState, u8string_view path, int32_t flags)
 
     PrepareMapForSave();
 
-    bool result = false;
     auto parkFile = std::make_unique<OpenRCT2::ParkFile>();
     try
     {
@@ -2659,15 +2688,60 @@ int32_t ScenarioSave(GameState_t& gameState, u8string_view path, int32_t flags)
             parkFile->ExportObjectsList = objManager.GetPackableObjects();
         }
         parkFile->OmitTracklessRides = true;
-        if (flags & S6_SAVE_FLAG_SCENARIO)
+        return std::make_shared<OrcaStream::Image>(parkFile->Capture(gameState));
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR(e.what());
+
+        Formatter ft;
+        ft.Add<const char*>(e.what());
+        ContextShowError(STR_FILE_DIALOG_TITLE_SAVE_SCENARIO, STR_STRING, ft);
+        GfxInvalidateScreen();
+        return nullptr;
+    }
+}
+
+static void ScenarioSaveWrite(OrcaStream::Image& image, u8string_view path)
+{
+    FileStream fs(path, FILE_MODE_WRITE);
+    image.Write(fs);
+}
+
+std::function<bool()> ScenarioSaveDeferred(GameState_t& gameState, u8string_view path, int32_t flags)
+{
+    auto image = ScenarioSaveCapture(gameState, flags);
+    if (image == nullptr)
+        return nullptr;
+
+    GfxInvalidateScreen();
+
+    // Only touches the captured image, so it can run on any thread. Nothing is shown when writing fails, as the
+    // caller may not be on the main thread, and gScreenAge is left to the caller as the save has not happened yet.
+    return [image, filePath = u8string(path)]() {
+        try
         {
-            // s6exporter->SaveScenario(path);
+            ScenarioSaveWrite(*image, filePath);
+            return true;
         }
-        else
+        catch (const std::exception& e)
         {
-            // s6exporter->SaveGame(path);
+            LOG_ERROR(e.what());
+            return false;
         }
-        parkFile->Save(gameState, path);
+    };
+}
+
+int32_t ScenarioSave(GameState_t& gameState, u8string_view path, int32_t flags)
+{
+    auto image = ScenarioSaveCapture(gameState, flags);
+    if (image == nullptr)
+        return false;
+
+    bool result = false;
+    try
+    {
+        ScenarioSaveWrite(*image, path);
         result = true;
     }
     catch (const std::exception& e)
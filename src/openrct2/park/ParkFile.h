@@ -10,8 +10,11 @@ namespace OpenRCT2
 {
     struct GameState_t;
 
-    // Current version that is saved.
-    constexpr uint32_t kParkFileCurrentVersion = 50;
+    // Current version that is saved with block compression, and the newest version that can be read.
+    constexpr uint32_t kParkFileCurrentVersion = 51;
+
+    // Version that is saved otherwise, as the chunks are the same as in the current version.
+    constexpr uint32_t kParkFileGzipVersion = 50;
 
     // The minimum version that is forwards compatible with the current version.
     constexpr uint32_t kParkFileMinVersion = 50;
@@ -39,6 +42,7 @@ namespace OpenRCT2
     constexpr uint16_t kExtendedStandUpRollerCoasterVersion = 48;
     constexpr uint16_t kPeepAnimationObjectsVersion = 49;
     constexpr uint16_t kDiagonalLongFlatToSteepAndDiveLoopVersion = 50;
+    constexpr uint16_t kBlockCompressionVersion = 51;
 } // namespace OpenRCT2
 
 class ParkFileExporter
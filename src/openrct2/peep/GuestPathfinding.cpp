@@ -26,6 +26,7 @@
 #include "../world/tile_element/PathElement.h"
 #include "../world/tile_element/TileElement.h"
 #include "../world/tile_element/TrackElement.h"
+#include "PathCorridorIndex.h"
 
 #include <bit>
 #include <bitset>
@@ -722,7 +723,7 @@ namespace OpenRCT2::PathFinding
      */
     static void PeepPathfindHeuristicSearch(
         PathFindingState& state, TileCoordsXYZ loc, const TileCoordsXYZ& goal, const Peep& peep,
-        TileElement* currentTileElement, const bool inPatrolArea, uint8_t numSteps, uint16_t* endScore, Direction testEdge,
+        TileElement* currentTileElement, bool inPatrolArea, uint8_t numSteps, uint16_t* endScore, Direction testEdge,
         uint8_t* endJunctions, TileCoordsXYZ junctionList[16], uint8_t directionList[16], TileCoordsXYZ* endXYZ,
         uint8_t* endSteps)
     {
@@ -736,6 +737,63 @@ namespace OpenRCT2::PathFinding
                 currentElementIsWide = false;
         }
 
+        if (PathCorridorIndex::IsEnabled())
+        {
+            /* Walk along corridor tiles without recursing, doing for each tile what the
+             * search below does for a thin path with one edge left to follow. The search
+             * continues below from the first tile that is not a corridor tile. */
+            const auto* staff = peep.As<Staff>();
+            const bool isMechanic = staff != nullptr && staff->IsMechanic();
+            const PathCorridorIndex::Corridor* corridor;
+            while ((corridor = PathCorridorIndex::Get(TileCoordsXY(loc) + TileDirectionDelta[testEdge])) != nullptr
+                   && corridor->CanEnter(testEdge, loc.z))
+            {
+                loc += TileDirectionDelta[testEdge];
+                ++numSteps;
+                state.countTilesChecked--;
+
+                if (state.history[0].location == loc)
+                    return;
+
+                if (isMechanic)
+                {
+                    const bool nextInPatrolArea = staff->IsLocationInPatrol(loc.ToCoordsXY());
+                    if (inPatrolArea && !nextInPatrolArea)
+                        return;
+                    inPatrolArea = nextInPatrolArea;
+                }
+
+                loc.z = corridor->BaseZ;
+                const uint16_t newScore = CalculateHeuristicPathingScore(loc, goal);
+                if (newScore == 0 || numSteps >= 200 || state.countTilesChecked <= 0)
+                {
+                    // The goal is reached or the search limits are hit, the search path ends here.
+                    if (newScore < *endScore || (newScore == *endScore && numSteps < *endSteps))
+                    {
+                        *endScore = newScore;
+                        *endSteps = numSteps;
+                        *endXYZ = loc;
+                        *endJunctions = state.maxJunctions - state.junctionCount;
+                        for (uint8_t junctInd = 0; junctInd < *endJunctions; junctInd++)
+                        {
+                            uint8_t histIdx = state.maxJunctions - junctInd;
+                            junctionList[junctInd] = state.history[histIdx].location;
+                            directionList[junctInd] = state.history[histIdx].direction;
+                        }
+                    }
+                    return;
+                }
+
+                const uint32_t edges = corridor->Edges & ~(1 << DirectionReverse(testEdge));
+                testEdge = Numerics::bitScanForward(edges);
+                if (corridor->SlopeDirection == testEdge)
+                {
+                    loc.z += 2;
+                }
+                currentElementIsWide = false;
+            }
+        }
+
         loc += TileDirectionDelta[testEdge];
 
         ++numSteps;
@@ -0,0 +1,149 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "PathCorridorIndex.h"
+
+#include "../config/Config.h"
+#include "../world/Map.h"
+#include "../world/tile_element/PathElement.h"
+#include "../world/tile_element/TileElement.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <vector>
+
+namespace OpenRCT2::PathCorridorIndex
+{
+    static constexpr int32_t kBlockSize = 8;
+    static constexpr int32_t kNumBlocksPerSide = (kMaximumMapSizeTechnical + kBlockSize - 1) / kBlockSize;
+
+    // Footpath edits reconnect the neighbouring tiles, track pieces extend a few tiles from their origin.
+    static constexpr int32_t kInvalidateMarginTiles = 8;
+
+    struct Block
+    {
+        bool IsDirty{ true };
+        std::array<Corridor, kBlockSize * kBlockSize> Tiles{};
+    };
+
+    static std::vector<Block> _blocks;
+
+    bool IsEnabled()
+    {
+        return Config::Get().general.CachePathCorridors;
+    }
+
+    static Corridor GetTileCorridor(const TileCoordsXY& loc)
+    {
+        const PathElement* path = nullptr;
+        const TileElement* tileElement = MapGetFirstElementAt(loc);
+        if (tileElement == nullptr)
+            return {};
+
+        do
+        {
+            switch (tileElement->GetType())
+            {
+                case TileElementType::Path:
+                    if (tileElement->IsGhost())
+                        break;
+                    // Overlaid paths are searched element by element.
+                    if (path != nullptr)
+                        return {};
+                    path = tileElement->AsPath();
+                    break;
+                case TileElementType::Banner:
+                    // No entry signs limit the edges of the path below, even when they are ghosts.
+                    return {};
+                case TileElementType::Track:
+                case TileElementType::Entrance:
+                    if (!tileElement->IsGhost())
+                        return {};
+                    break;
+                default:
+                    break;
+            }
+        } while (!(tileElement++)->IsLastForTile());
+
+        if (path == nullptr || path->IsWide() || path->IsQueue() || std::popcount(path->GetEdges()) != 2)
+            return {};
+
+        Corridor corridor;
+        corridor.BaseZ = path->BaseHeight;
+        corridor.Edges = path->GetEdges();
+        if (path->IsSloped())
+        {
+            corridor.SlopeDirection = path->GetSlopeDirection();
+        }
+        return corridor;
+    }
+
+    static void RebuildBlock(Block& block, int32_t blockX, int32_t blockY)
+    {
+        for (int32_t y = 0; y < kBlockSize; y++)
+        {
+            for (int32_t x = 0; x < kBlockSize; x++)
+            {
+                const auto loc = TileCoordsXY{ blockX * kBlockSize + x, blockY * kBlockSize + y };
+                block.Tiles[y * kBlockSize + x] = GetTileCorridor(loc);
+            }
+        }
+        block.IsDirty = false;
+    }
+
+    const Corridor* Get(const TileCoordsXY& loc)
+    {
+        if (loc.x < 0 || loc.y < 0 || loc.x >= kMaximumMapSizeTechnical || loc.y >= kMaximumMapSizeTechnical)
+            return nullptr;
+
+        if (_blocks.empty())
+        {
+            _blocks.resize(kNumBlocksPerSide * kNumBlocksPerSide);
+        }
+
+        const auto blockX = loc.x / kBlockSize;
+        const auto blockY = loc.y / kBlockSize;
+        auto& block = _blocks[blockY * kNumBlocksPerSide + blockX];
+        if (block.IsDirty)
+        {
+            RebuildBlock(block, blockX, blockY);
+        }
+
+        const auto& corridor = block.Tiles[(loc.y % kBlockSize) * kBlockSize + (loc.x % kBlockSize)];
+        return corridor.Edges != 0 ? &corridor : nullptr;
+    }
+
+    void Invalidate(const CoordsXY& loc)
+    {
+        if (_blocks.empty())
+            return;
+
+        const auto tile = TileCoordsXY(loc);
+        const auto minX = std::max(tile.x - kInvalidateMarginTiles, 0) / kBlockSize;
+        const auto minY = std::max(tile.y - kInvalidateMarginTiles, 0) / kBlockSize;
+        const auto maxX = std::min((tile.x + kInvalidateMarginTiles) / kBlockSize, kNumBlocksPerSide - 1);
+        const auto maxY = std::min((tile.y + kInvalidateMarginTiles) / kBlockSize, kNumBlocksPerSide - 1);
+        for (auto blockY = minY; blockY <= maxY; blockY++)
+        {
+            for (auto blockX = minX; blockX <= maxX; blockX++)
+            {
+                _blocks[blockY * kNumBlocksPerSide + blockX].IsDirty = true;
+            }
+        }
+    }
+
+    void Invalidate()
+    {
+        for (auto& block : _blocks)
+        {
+            block.IsDirty = true;
+        }
+    }
+} // namespace OpenRCT2::PathCorridorIndex
@@ -0,0 +1,54 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../world/Location.hpp"
+
+#include <cstdint>
+
+/**
+ * Index of the corridor tiles of the footpath network: tiles whose only element of interest to the path
+ * finding is a single thin, non-queue path with exactly two edges and no banners. The heuristic search
+ * walks along runs of such tiles without reading the tile elements, up to the next junction, dead end,
+ * wide path or other element where it continues tile by tile.
+ *
+ * The map is split into blocks of 8x8 tiles that are rebuilt from the tile elements the first time they
+ * are queried after a change nearby.
+ */
+namespace OpenRCT2::PathCorridorIndex
+{
+    constexpr uint8_t kFlatPath = 0xFF;
+
+    struct Corridor
+    {
+        uint8_t BaseZ;
+        uint8_t Edges;
+        uint8_t SlopeDirection{ kFlatPath };
+
+        // Same as FootpathIsZAndDirectionValid, also requiring an edge back to the previous tile.
+        bool CanEnter(Direction direction, int32_t z) const
+        {
+            if (!(Edges & (1 << DirectionReverse(direction))))
+                return false;
+            if (SlopeDirection == kFlatPath || SlopeDirection == direction)
+                return z == BaseZ;
+            return SlopeDirection == DirectionReverse(direction) && z == BaseZ + 2;
+        }
+    };
+
+    bool IsEnabled();
+
+    // Returns the corridor on the tile or nullptr if the tile is not a corridor tile.
+    const Corridor* Get(const TileCoordsXY& loc);
+
+    // Marks the blocks around a changed tile, or every block, as needing a rebuild.
+    void Invalidate(const CoordsXY& loc);
+    void Invalidate();
+} // namespace OpenRCT2::PathCorridorIndex
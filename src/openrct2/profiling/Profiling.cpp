@@ -137,6 +137,7 @@ namespace OpenRCT2::Profiling
             funcInternal->CallCount = 0;
             funcInternal->MinTimeUs = 0.0;
             funcInternal->MaxTimeUs = 0.0;
+            funcInternal->TotalTimeUs = 0.0;
             funcInternal->SampleIterator = 0;
             funcInternal->Children.clear();
             funcInternal->Parents.clear();
@@ -0,0 +1,176 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TickTimings.h"
+
+#include "../core/Console.hpp"
+#include "../core/Json.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+
+namespace OpenRCT2::Profiling
+{
+    // Nearest rank percentile of sorted samples.
+    static double Percentile(const std::vector<double>& sorted, double percentile)
+    {
+        const auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * sorted.size()));
+        return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+    }
+
+    TimingStats TimingStats::FromSamples(std::vector<double> samples)
+    {
+        TimingStats stats;
+        if (samples.empty())
+            return stats;
+
+        std::sort(samples.begin(), samples.end());
+        stats.Count = samples.size();
+        stats.TotalUs = std::accumulate(samples.begin(), samples.end(), 0.0);
+        stats.MeanUs = stats.TotalUs / samples.size();
+        stats.MinUs = samples.front();
+        stats.P50Us = Percentile(samples, 50);
+        stats.P90Us = Percentile(samples, 90);
+        stats.P99Us = Percentile(samples, 99);
+        stats.MaxUs = samples.back();
+        return stats;
+    }
+
+    void TickTimings::Begin()
+    {
+        _tickTimes.clear();
+        _series.clear();
+        for (const auto* func : GetData())
+        {
+            _series.push_back({ func, func->GetTotalTime(), func->GetCallCount(), {} });
+        }
+    }
+
+    void TickTimings::RecordTick(double tickTimeUs)
+    {
+        _tickTimes.push_back(tickTimeUs);
+        for (auto& series : _series)
+        {
+            const auto totalUs = series.Func->GetTotalTime();
+            series.Samples.push_back(totalUs - series.LastTotalUs);
+            series.LastTotalUs = totalUs;
+        }
+    }
+
+    uint64_t TickTimings::GetNumCalls(const Function* func) const
+    {
+        auto it = std::find_if(_series.begin(), _series.end(), [func](const Series& series) { return series.Func == func; });
+        return it != _series.end() ? func->GetCallCount() - it->InitialCallCount : 0;
+    }
+
+    size_t TickTimings::GetNumTicks() const
+    {
+        return _tickTimes.size();
+    }
+
+    TimingStats TickTimings::GetTickStats() const
+    {
+        return TimingStats::FromSamples(_tickTimes);
+    }
+
+    std::vector<std::pair<const Function*, TimingStats>> TickTimings::GetFunctionStats() const
+    {
+        std::vector<std::pair<const Function*, TimingStats>> result;
+        for (const auto& series : _series)
+        {
+            if (series.Func->GetCallCount() == series.InitialCallCount)
+                continue;
+
+            result.emplace_back(series.Func, TimingStats::FromSamples(series.Samples));
+        }
+
+        std::sort(result.begin(), result.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.second.TotalUs > rhs.second.TotalUs;
+        });
+        return result;
+    }
+
+    void TickTimings::PrintSummary() const
+    {
+        const auto tickStats = GetTickStats();
+        Console::WriteLine(
+            "%-60s %10s %10s %10s %10s %10s", "function (microseconds per tick)", "mean", "p50", "p90", "p99", "max");
+        Console::WriteLine(
+            "%-60s %10.1f %10.1f %10.1f %10.1f %10.1f", "tick", tickStats.MeanUs, tickStats.P50Us, tickStats.P90Us,
+            tickStats.P99Us, tickStats.MaxUs);
+        for (const auto& [func, stats] : GetFunctionStats())
+        {
+            Console::WriteLine(
+                "%-60.60s %10.1f %10.1f %10.1f %10.1f %10.1f", func->GetName(), stats.MeanUs, stats.P50Us, stats.P90Us,
+                stats.P99Us, stats.MaxUs);
+        }
+    }
+
+    static json_t StatsToJson(const TimingStats& stats)
+    {
+        return json_t{
+            { "ticks", stats.Count },   { "total_us", stats.TotalUs }, { "mean_us", stats.MeanUs },
+            { "min_us", stats.MinUs },  { "p50_us", stats.P50Us },     { "p90_us", stats.P90Us },
+            { "p99_us", stats.P99Us },  { "max_us", stats.MaxUs },
+        };
+    }
+
+    bool TickTimings::ExportJSON(const u8string& path) const
+    {
+        json_t functions = json_t::array();
+        for (const auto& [func, stats] : GetFunctionStats())
+        {
+            auto jsonFunc = StatsToJson(stats);
+            jsonFunc["name"] = func->GetName();
+            jsonFunc["calls"] = GetNumCalls(func);
+            functions.push_back(std::move(jsonFunc));
+        }
+
+        json_t report = {
+            { "tick", StatsToJson(GetTickStats()) },
+            { "functions", std::move(functions) },
+        };
+
+        try
+        {
+            Json::WriteToFile(path, report);
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to write %s: %s", path.c_str(), e.what());
+            return false;
+        }
+        return true;
+    }
+
+    bool TickTimings::ExportCSV(const u8string& path) const
+    {
+        std::ofstream out(path);
+        if (!out.is_open())
+            return false;
+
+        auto writeRow = [&out](const char* name, const TimingStats& stats) {
+            out << "\"" << name << "\";" << stats.Count << ";" << stats.TotalUs << ";" << stats.MeanUs << ";" << stats.MinUs
+                << ";" << stats.P50Us << ";" << stats.P90Us << ";" << stats.P99Us << ";" << stats.MaxUs << "\n";
+        };
+
+        out << "function_name;ticks;total_microseconds;mean_microseconds;min_microseconds;p50_microseconds;"
+               "p90_microseconds;p99_microseconds;max_microseconds\n";
+        out << std::setprecision(12);
+        writeRow("tick", GetTickStats());
+        for (const auto& [func, stats] : GetFunctionStats())
+        {
+            writeRow(func->GetName(), stats);
+        }
+        return true;
+    }
+} // namespace OpenRCT2::Profiling
@@ -0,0 +1,68 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../core/StringTypes.h"
+#include "Profiling.h"
+
+#include <vector>
+
+namespace OpenRCT2::Profiling
+{
+    struct TimingStats
+    {
+        uint64_t Count{};
+        double TotalUs{};
+        double MeanUs{};
+        double MinUs{};
+        double P50Us{};
+        double P90Us{};
+        double P99Us{};
+        double MaxUs{};
+
+        static TimingStats FromSamples(std::vector<double> samples);
+    };
+
+    /**
+     * Records the wall time of every tick together with the time spent in each profiled function
+     * during that tick, so percentiles can be reported over a whole run rather than over the small
+     * sample window kept by the profiler. Profiling must be enabled while recording.
+     */
+    class TickTimings
+    {
+        struct Series
+        {
+            const Function* Func;
+            double LastTotalUs;
+            uint64_t InitialCallCount;
+            std::vector<double> Samples;
+        };
+
+        std::vector<double> _tickTimes;
+        std::vector<Series> _series;
+
+    public:
+        // Takes the current totals of all profiled functions as the baseline for the first tick.
+        void Begin();
+        void RecordTick(double tickTimeUs);
+
+        size_t GetNumTicks() const;
+        TimingStats GetTickStats() const;
+
+        uint64_t GetNumCalls(const Function* func) const;
+
+        // Returns the stats of every function that was called during the recorded ticks.
+        std::vector<std::pair<const Function*, TimingStats>> GetFunctionStats() const;
+
+        void PrintSummary() const;
+        bool ExportJSON(const u8string& path) const;
+        bool ExportCSV(const u8string& path) const;
+    };
+} // namespace OpenRCT2::Profiling
@@ -31,6 +31,7 @@
 #include "../entity/EntityRegistry.h"
 #include "../entity/Peep.h"
 #include "../entity/Staff.h"
+#include "../entity/StaffSpatialIndex.h"
 #include "../interface/Viewport.h"
 #include "../interface/Window_internal.h"
 #include "../localisation/Formatter.h"
@@ -74,6 +75,7 @@
 #include "ShopItem.h"
 #include "Station.h"
 #include "Track.h"
+#include "TrackCircuitCache.h"
 #include "TrackData.h"
 #include "TrackDesign.h"
 #include "TrainManager.h"
@@ -114,6 +116,10 @@ const StringId kRideInspectionIntervalNames[] = {
 // A special instance of Ride that is used to draw previews such as the track designs.
 static Ride _previewRide{};
 
+// Positions of the staff for the mechanic searches of Ride::UpdateAll.
+static StaffSpatialIndex _staffIndex;
+static bool _staffIndexEnabled{};
+
 struct StationIndexWithMessage
 {
     ::StationIndex StationIndex;
@@ -490,15 +496,7 @@ bool RideTryGetOriginElement(const Ride& ride, CoordsXYE* output)
     return resultTileElement != nullptr;
 }
 
-/**
- *
- * rct2: 0x006C6096
- * Gets the next track block coordinates from the
- * coordinates of the first of element of a track block.
- * Use track_block_get_next if you are unsure if you are
- * on the first element of a track block
- */
-bool TrackBlockGetNextFromZero(
+static bool TrackBlockScanNext(
     const CoordsXYZ& startPos, const Ride& ride, uint8_t direction_start, CoordsXYE* output, int32_t* z, int32_t* direction,
     bool isGhost)
 {
@@ -563,6 +561,45 @@ bool TrackBlockGetNextFromZero(
     return false;
 }
 
+static bool ApplyNextPiece(const TrackCircuitCache::NextPiece& next, CoordsXYE* output, int32_t* z, int32_t* direction)
+{
+    if (z != nullptr)
+        *z = next.Z;
+    if (direction != nullptr)
+        *direction = next.Direction;
+    *output = next.Output;
+    return next.Found;
+}
+
+/**
+ *
+ * rct2: 0x006C6096
+ * Gets the next track block coordinates from the
+ * coordinates of the first of element of a track block.
+ * Use track_block_get_next if you are unsure if you are
+ * on the first element of a track block
+ */
+bool TrackBlockGetNextFromZero(
+    const CoordsXYZ& startPos, const Ride& ride, uint8_t direction_start, CoordsXYE* output, int32_t* z, int32_t* direction,
+    bool isGhost)
+{
+    if (isGhost || !TrackCircuitCache::IsEnabled())
+        return TrackBlockScanNext(startPos, ride, direction_start, output, z, direction, isGhost);
+
+    if (const auto* cachedNext = TrackCircuitCache::FindNext(ride.id, startPos, direction_start))
+        return ApplyNextPiece(*cachedNext, output, z, direction);
+
+    TrackCircuitCache::NextPiece next;
+    next.Found = TrackBlockScanNext(startPos, ride, direction_start, &next.Output, &next.Z, &next.Direction, false);
+
+    // Off the map only some of the outputs are written, leave the rest to the caller as the search does.
+    if (next.Output.element == nullptr)
+        return TrackBlockScanNext(startPos, ride, direction_start, output, z, direction, false);
+
+    TrackCircuitCache::SetNext(ride.id, startPos, direction_start, next);
+    return ApplyNextPiece(next, output, z, direction);
+}
+
 /**
  *
  *  rct2: 0x006C60C2
@@ -610,15 +647,7 @@ bool TrackBlockGetNext(CoordsXYE* input, CoordsXYE* output, int32_t* z, int32_t*
     return TrackBlockGetNextFromZero({ coords, OriginZ }, *ride, directionStart, output, z, direction, false);
 }
 
-/**
- * Returns the begin position / direction and end position / direction of the
- * track piece that proceeds the given location. Gets the previous track block
- * coordinates from the coordinates of the first of element of a track block.
- * Use track_block_get_previous if you are unsure if you are on the first
- * element of a track block
- *  rct2: 0x006C63D6
- */
-bool TrackBlockGetPreviousFromZero(
+static bool TrackBlockScanPrevious(
     const CoordsXYZ& startPos, const Ride& ride, uint8_t direction, TrackBeginEnd* outTrackBeginEnd)
 {
     uint8_t directionStart = direction;
@@ -701,6 +730,41 @@ bool TrackBlockGetPreviousFromZero(
     return false;
 }
 
+/**
+ * Returns the begin position / direction and end position / direction of the
+ * track piece that proceeds the given location. Gets the previous track block
+ * coordinates from the coordinates of the first of element of a track block.
+ * Use track_block_get_previous if you are unsure if you are on the first
+ * element of a track block
+ *  rct2: 0x006C63D6
+ */
+bool TrackBlockGetPreviousFromZero(
+    const CoordsXYZ& startPos, const Ride& ride, uint8_t direction, TrackBeginEnd* outTrackBeginEnd)
+{
+    if (!TrackCircuitCache::IsEnabled())
+        return TrackBlockScanPrevious(startPos, ride, direction, outTrackBeginEnd);
+
+    // Only the fields a successful search writes are copied, end_element is left as the caller set it.
+    if (const auto* cachedPrevious = TrackCircuitCache::FindPrevious(ride.id, startPos, direction))
+    {
+        outTrackBeginEnd->begin_x = cachedPrevious->begin_x;
+        outTrackBeginEnd->begin_y = cachedPrevious->begin_y;
+        outTrackBeginEnd->begin_z = cachedPrevious->begin_z;
+        outTrackBeginEnd->begin_direction = cachedPrevious->begin_direction;
+        outTrackBeginEnd->begin_element = cachedPrevious->begin_element;
+        outTrackBeginEnd->end_x = cachedPrevious->end_x;
+        outTrackBeginEnd->end_y = cachedPrevious->end_y;
+        outTrackBeginEnd->end_direction = cachedPrevious->end_direction;
+        return true;
+    }
+
+    if (!TrackBlockScanPrevious(startPos, ride, direction, outTrackBeginEnd))
+        return false;
+
+    TrackCircuitCache::SetPrevious(ride.id, startPos, direction, *outTrackBeginEnd);
+    return true;
+}
+
 /**
  *
  *  rct2: 0x006C6402
@@ -987,8 +1051,11 @@ void Ride::UpdateAll()
     WindowUpdateViewportRideMusic();
 
     // Update rides
+    _staffIndexEnabled = true;
     for (auto& ride : GetRideManager())
         ride.Update();
+    _staffIndexEnabled = false;
+    _staffIndex.Clear();
 
     OpenRCT2::RideAudio::UpdateMusicChannels();
 }
@@ -1139,6 +1206,9 @@ void Ride::Update()
             RideSetStatusAction gameAction = RideSetStatusAction(id, RideStatus::Simulating);
             GameActions::ExecuteNested(&gameAction);
         }
+
+        // Changing the status can move peeps off the ride.
+        _staffIndex.Clear();
     }
 }
 
@@ -1766,6 +1836,35 @@ Staff* RideFindClosestMechanic(const Ride& ride, int32_t forInspection)
     return FindClosestMechanic(centreMapLocation, forInspection);
 }
 
+static bool MechanicIsAvailable(const Staff& staff, const CoordsXY& entrancePosition, int32_t forInspection)
+{
+    if (!forInspection)
+    {
+        if (staff.State == PeepState::HeadingToInspection)
+        {
+            if (staff.SubState >= 4)
+                return false;
+        }
+        else if (staff.State != PeepState::Patrolling)
+            return false;
+
+        if (!(staff.StaffOrders & STAFF_ORDERS_FIX_RIDES))
+            return false;
+    }
+    else
+    {
+        if (staff.State != PeepState::Patrolling || !(staff.StaffOrders & STAFF_ORDERS_INSPECT_RIDES))
+            return false;
+    }
+
+    auto location = entrancePosition.ToTileStart();
+    if (MapIsLocationInPark(location))
+        if (!staff.IsLocationInPatrol(location))
+            return false;
+
+    return true;
+}
+
 /**
  *
  *  rct2: 0x006B774B (forInspection = 0)
@@ -1773,6 +1872,18 @@ Staff* RideFindClosestMechanic(const Ride& ride, int32_t forInspection)
  */
 Staff* FindClosestMechanic(const CoordsXY& entrancePosition, int32_t forInspection)
 {
+    if (_staffIndexEnabled)
+    {
+        // Staff do not move while rides update, one snapshot serves all calls of the tick.
+        if (!_staffIndex.IsBuilt())
+        {
+            _staffIndex.Build();
+        }
+        return _staffIndex.FindClosest(StaffType::Mechanic, entrancePosition, [&](const Staff& staff) {
+            return MechanicIsAvailable(staff, entrancePosition, forInspection);
+        });
+    }
+
     Staff* closestMechanic = nullptr;
     uint32_t closestDistance = std::numeric_limits<uint32_t>::max();
 
@@ -1781,29 +1892,8 @@ Staff* FindClosestMechanic(const CoordsXY& entrancePosition, int32_t forInspecti
         if (!peep->IsMechanic())
             continue;
 
-        if (!forInspection)
-        {
-            if (peep->State == PeepState::HeadingToInspection)
-            {
-                if (peep->SubState >= 4)
-                    continue;
-            }
-            else if (peep->State != PeepState::Patrolling)
-                continue;
-
-            if (!(peep->StaffOrders & STAFF_ORDERS_FIX_RIDES))
-                continue;
-        }
-        else
-        {
-            if (peep->State != PeepState::Patrolling || !(peep->StaffOrders & STAFF_ORDERS_INSPECT_RIDES))
-                continue;
-        }
-
-        auto location = entrancePosition.ToTileStart();
-        if (MapIsLocationInPark(location))
-            if (!peep->IsLocationInPatrol(location))
-                continue;
+        if (!MechanicIsAvailable(*peep, entrancePosition, forInspection))
+            continue;
 
         if (peep->x == kLocationNull)
             continue;
@@ -284,6 +284,9 @@ struct Ride
     uint8_t current_issues{};
     uint32_t last_issue_time{};
 
+    // Last proximity walk of the ratings calculation, only kept for the current session.
+    RideRatingsCache ratingsCache{};
+
     // TO-DO: those friend functions are temporary, find a way to not access the private fields
     friend void UpdateSpiralSlide(Ride& ride);
     friend void UpdateChairlift(Ride& ride);
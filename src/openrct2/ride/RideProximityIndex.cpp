@@ -0,0 +1,203 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "RideProximityIndex.h"
+
+#include "../config/Config.h"
+#include "../world/Map.h"
+#include "../world/TileElementsView.h"
+#include "../world/tile_element/TrackElement.h"
+#include "Ride.h"
+#include "RideManager.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace OpenRCT2::RideProximityIndex
+{
+    static constexpr int32_t kBlockSize = 8;
+    static constexpr int32_t kNumBlocksPerSide = (kMaximumMapSizeTechnical + kBlockSize - 1) / kBlockSize;
+
+    // Track pieces extend a few tiles from the location reported by the action that placed them.
+    static constexpr int32_t kInvalidateMarginTiles = 8;
+
+    struct Entry
+    {
+        uint8_t X;
+        uint8_t Y;
+        RideId Ride;
+    };
+
+    struct Block
+    {
+        bool IsDirty{ true };
+        RideSet Rides;
+        std::vector<Entry> Entries;
+    };
+
+    static std::vector<Block> _blocks;
+    static RideSet _landmarkRides;
+    static bool _landmarkRidesValid{};
+
+    bool IsEnabled()
+    {
+        return Config::Get().general.RideProximityIndex;
+    }
+
+    static void RebuildBlock(Block& block, int32_t blockX, int32_t blockY)
+    {
+        block.Rides.reset();
+        block.Entries.clear();
+        for (int32_t y = 0; y < kBlockSize; y++)
+        {
+            for (int32_t x = 0; x < kBlockSize; x++)
+            {
+                const auto location = TileCoordsXY{ blockX * kBlockSize + x, blockY * kBlockSize + y }.ToCoordsXY();
+                if (!MapIsLocationValid(location))
+                    continue;
+
+                const auto firstEntry = block.Entries.size();
+                for (auto* trackElement : TileElementsView<TrackElement>(location))
+                {
+                    const auto rideIndex = trackElement->GetRideIndex();
+                    if (rideIndex.IsNull())
+                        continue;
+
+                    // Tiles usually hold one ride, only keep an entry per ride and tile.
+                    const auto tileEntries = block.Entries.begin() + firstEntry;
+                    if (std::none_of(tileEntries, block.Entries.end(), [rideIndex](const Entry& entry) {
+                            return entry.Ride == rideIndex;
+                        }))
+                    {
+                        block.Entries.push_back({ static_cast<uint8_t>(x), static_cast<uint8_t>(y), rideIndex });
+                        block.Rides[rideIndex.ToUnderlying()] = true;
+                    }
+                }
+            }
+        }
+        block.IsDirty = false;
+    }
+
+    static const Block& GetBlock(int32_t blockX, int32_t blockY)
+    {
+        if (_blocks.empty())
+        {
+            _blocks.resize(kNumBlocksPerSide * kNumBlocksPerSide);
+        }
+
+        auto& block = _blocks[blockY * kNumBlocksPerSide + blockX];
+        if (block.IsDirty)
+        {
+            RebuildBlock(block, blockX, blockY);
+        }
+        return block;
+    }
+
+    void Invalidate(const CoordsXY& loc)
+    {
+        if (_blocks.empty())
+            return;
+
+        const auto tile = TileCoordsXY(loc);
+        const auto minX = std::max(tile.x - kInvalidateMarginTiles, 0) / kBlockSize;
+        const auto minY = std::max(tile.y - kInvalidateMarginTiles, 0) / kBlockSize;
+        const auto maxX = std::min((tile.x + kInvalidateMarginTiles) / kBlockSize, kNumBlocksPerSide - 1);
+        const auto maxY = std::min((tile.y + kInvalidateMarginTiles) / kBlockSize, kNumBlocksPerSide - 1);
+        for (auto blockY = minY; blockY <= maxY; blockY++)
+        {
+            for (auto blockX = minX; blockX <= maxX; blockX++)
+            {
+                _blocks[blockY * kNumBlocksPerSide + blockX].IsDirty = true;
+            }
+        }
+    }
+
+    void Invalidate()
+    {
+        for (auto& block : _blocks)
+        {
+            block.IsDirty = true;
+        }
+    }
+
+    void AddRidesInRange(const TileCoordsXY& min, const TileCoordsXY& max, RideSet& rides)
+    {
+        // Tiles outside the technical map size are never valid.
+        const auto minX = std::max(min.x, 0);
+        const auto minY = std::max(min.y, 0);
+        const auto maxX = std::min<int32_t>(max.x, kMaximumMapSizeTechnical - 1);
+        const auto maxY = std::min<int32_t>(max.y, kMaximumMapSizeTechnical - 1);
+        if (minX > maxX || minY > maxY)
+            return;
+
+        for (auto blockY = minY / kBlockSize; blockY <= maxY / kBlockSize; blockY++)
+        {
+            for (auto blockX = minX / kBlockSize; blockX <= maxX / kBlockSize; blockX++)
+            {
+                const auto& block = GetBlock(blockX, blockY);
+                if (block.Entries.empty())
+                    continue;
+
+                const auto originX = blockX * kBlockSize;
+                const auto originY = blockY * kBlockSize;
+                if (originX >= minX && originY >= minY && originX + kBlockSize - 1 <= maxX
+                    && originY + kBlockSize - 1 <= maxY)
+                {
+                    rides |= block.Rides;
+                    continue;
+                }
+
+                for (const auto& entry : block.Entries)
+                {
+                    const auto x = originX + entry.X;
+                    const auto y = originY + entry.Y;
+                    if (x >= minX && x <= maxX && y >= minY && y <= maxY)
+                    {
+                        rides[entry.Ride.ToUnderlying()] = true;
+                    }
+                }
+            }
+        }
+    }
+
+    static void GetLandmarkRides(RideSet& rides)
+    {
+        for (auto& ride : GetRideManager())
+        {
+            if (ride.highest_drop_height > 66 || ride.ratings.excitement >= RIDE_RATING(8, 00))
+            {
+                rides[ride.id.ToUnderlying()] = true;
+            }
+        }
+    }
+
+    void AddLandmarkRides(RideSet& rides)
+    {
+        if (_landmarkRidesValid)
+        {
+            rides |= _landmarkRides;
+        }
+        else
+        {
+            GetLandmarkRides(rides);
+        }
+    }
+
+    void BeginGuestUpdate()
+    {
+        _landmarkRides.reset();
+        GetLandmarkRides(_landmarkRides);
+        _landmarkRidesValid = true;
+    }
+
+    void EndGuestUpdate()
+    {
+        _landmarkRidesValid = false;
+    }
+} // namespace OpenRCT2::RideProximityIndex
@@ -0,0 +1,44 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../Limits.h"
+#include "../core/BitSet.hpp"
+#include "../world/Location.hpp"
+
+/**
+ * Index of the rides that have track on each tile, used by guests looking for a ride to go on.
+ *
+ * The map is split into blocks of 8x8 tiles, each holding the set of rides with track in the block and the
+ * individual tiles they are on. Blocks are rebuilt from the tile elements the first time they are queried
+ * after a change, so a query returns exactly what scanning the tiles would.
+ *
+ * The landmark rides, the ones guests consider from anywhere in the park, are only cached between
+ * BeginGuestUpdate and EndGuestUpdate as nothing changes their drop height or ratings while guests update.
+ */
+namespace OpenRCT2::RideProximityIndex
+{
+    using RideSet = BitSet<Limits::kMaxRidesInPark>;
+
+    bool IsEnabled();
+
+    // Marks the blocks around a changed tile, or every block, as needing a rebuild.
+    void Invalidate(const CoordsXY& loc);
+    void Invalidate();
+
+    // Adds every ride with track on a valid tile in the inclusive range.
+    void AddRidesInRange(const TileCoordsXY& min, const TileCoordsXY& max, RideSet& rides);
+
+    // Adds the rides that are tall or exciting enough to be seen from anywhere in the park.
+    void AddLandmarkRides(RideSet& rides);
+
+    void BeginGuestUpdate();
+    void EndGuestUpdate();
+} // namespace OpenRCT2::RideProximityIndex
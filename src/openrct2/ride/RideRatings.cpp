@@ -13,6 +13,7 @@
 #include "../Context.h"
 #include "../GameState.h"
 #include "../OpenRCT2.h"
+#include "../config/Config.h"
 #include "../core/UnitConversion.h"
 #include "../interface/Window.h"
 #include "../profiling/Profiling.h"
@@ -29,6 +30,7 @@
 #include "Track.h"
 #include "TrackData.h"
 
+#include <algorithm>
 #include <iterator>
 
 using namespace OpenRCT2;
@@ -42,7 +44,8 @@ enum
     RIDE_RATINGS_STATE_2,
     RIDE_RATINGS_STATE_CALCULATE,
     RIDE_RATINGS_STATE_4,
-    RIDE_RATINGS_STATE_5
+    RIDE_RATINGS_STATE_5,
+    RIDE_RATINGS_STATE_CACHED_WALK,
 };
 
 enum
@@ -87,7 +90,11 @@ struct ShelteredEights
 // would be currently 80, this is the worst case of sub-steps and may break out earlier.
 static constexpr size_t MaxRideRatingUpdateSubSteps = 20;
 
-static void ride_ratings_update_state(RideRatingUpdateState& state);
+// Distance around the walked track pieces in which a map change invalidates the cached walk, this covers the
+// neighbouring tiles that are scored and the tiles of multi-tile track pieces.
+static constexpr int32_t kRideRatingsCacheMargin = 8 * kCoordsXYStep;
+
+static void ride_ratings_update_state(RideRatingUpdateState& state, bool useCache);
 static void ride_ratings_update_state_0(RideRatingUpdateState& state);
 static void ride_ratings_update_state_1(RideRatingUpdateState& state);
 static void ride_ratings_update_state_2(RideRatingUpdateState& state);
@@ -179,7 +186,7 @@ void RideRatingsUpdateRide(const Ride& ride)
         state.State = RIDE_RATINGS_STATE_INITIALISE;
         while (state.State != RIDE_RATINGS_STATE_FIND_NEXT_RIDE)
         {
-            ride_ratings_update_state(state);
+            ride_ratings_update_state(state, false);
         }
     }
 }
@@ -195,11 +202,12 @@ void RideRatingsUpdateAll()
     if (gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR)
         return;
 
+    const auto useCache = Config::Get().general.IncrementalRideRatings;
     for (auto& updateState : GetGameState().RideRatingUpdateStates)
     {
         for (size_t i = 0; i < MaxRideRatingUpdateSubSteps; ++i)
         {
-            ride_ratings_update_state(updateState);
+            ride_ratings_update_state(updateState, useCache);
 
             // We need to abort the loop if the state machine requested to find the next ride.
             if (updateState.State == RIDE_RATINGS_STATE_FIND_NEXT_RIDE)
@@ -208,8 +216,132 @@ void RideRatingsUpdateAll()
     }
 }
 
-static void ride_ratings_update_state(RideRatingUpdateState& state)
+static bool IsProximityWalkState(uint8_t state)
+{
+    return state == RIDE_RATINGS_STATE_INITIALISE || state == RIDE_RATINGS_STATE_2 || state == RIDE_RATINGS_STATE_4
+        || state == RIDE_RATINGS_STATE_5;
+}
+
+static void RideRatingsTrackWalk(RideRatingUpdateState& state, uint8_t previousState, bool useCache)
+{
+    if (previousState == RIDE_RATINGS_STATE_INITIALISE)
+    {
+        state.WalkSteps = 0;
+        state.WalkBoundsMin = state.Proximity;
+        state.WalkBoundsMax = state.Proximity;
+    }
+    if (state.WalkSteps == kRideRatingWalkStepsUnknown)
+        return;
+
+    state.WalkSteps++;
+    state.WalkBoundsMin.x = std::min(state.WalkBoundsMin.x, state.Proximity.x);
+    state.WalkBoundsMin.y = std::min(state.WalkBoundsMin.y, state.Proximity.y);
+    state.WalkBoundsMax.x = std::max(state.WalkBoundsMax.x, state.Proximity.x);
+    state.WalkBoundsMax.y = std::max(state.WalkBoundsMax.y, state.Proximity.y);
+
+    auto* ride = GetRide(state.CurrentRide);
+    if (!useCache || ride == nullptr)
+        return;
+
+    auto& cache = ride->ratingsCache;
+    if (state.State == RIDE_RATINGS_STATE_CALCULATE)
+    {
+        cache.IsValid = true;
+        cache.NumSteps = state.WalkSteps;
+        cache.Result = state;
+    }
+    else if (
+        previousState == RIDE_RATINGS_STATE_INITIALISE && state.State == RIDE_RATINGS_STATE_2 && cache.IsValid
+        && cache.NumSteps > state.WalkSteps && cache.Result.ProximityStart == state.ProximityStart)
+    {
+        state.State = RIDE_RATINGS_STATE_CACHED_WALK;
+    }
+}
+
+/**
+ * Takes the place of the walk steps while the map around the ride is unchanged. A walk that is aborted because the
+ * ride was closed leaves different scratch values in the state than a real walk, these are reset before they are
+ * read again.
+ */
+static void RideRatingsUpdateCachedWalk(RideRatingUpdateState& state)
+{
+    const auto* ride = GetRide(state.CurrentRide);
+    if (ride == nullptr || ride->status == RideStatus::Closed)
+    {
+        state.State = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+        return;
+    }
+
+    state.WalkSteps++;
+    if (state.WalkSteps >= ride->ratingsCache.NumSteps)
+    {
+        state = ride->ratingsCache.Result;
+    }
+}
+
+// Repeats the steps of a cached walk for real, the map has not changed since they were counted.
+static void RideRatingsMaterialiseWalk(RideRatingUpdateState& state)
+{
+    const auto numSteps = state.WalkSteps;
+    state.State = RIDE_RATINGS_STATE_INITIALISE;
+    for (uint32_t i = 0; i < numSteps && state.State != RIDE_RATINGS_STATE_FIND_NEXT_RIDE; i++)
+    {
+        ride_ratings_update_state(state, false);
+    }
+}
+
+void RideRatingsFlushCachedWalks()
+{
+    for (auto& state : GetGameState().RideRatingUpdateStates)
+    {
+        if (state.State == RIDE_RATINGS_STATE_CACHED_WALK)
+        {
+            RideRatingsMaterialiseWalk(state);
+        }
+    }
+}
+
+// Walks that are in progress have already seen part of the old map, so their result can not be cached.
+static void RideRatingsStopCachingWalks()
+{
+    RideRatingsFlushCachedWalks();
+    for (auto& state : GetGameState().RideRatingUpdateStates)
+    {
+        if (IsProximityWalkState(state.State))
+        {
+            state.WalkSteps = kRideRatingWalkStepsUnknown;
+        }
+    }
+}
+
+void RideRatingsInvalidateCache()
 {
+    RideRatingsStopCachingWalks();
+    for (auto& ride : GetRideManager())
+    {
+        ride.ratingsCache.IsValid = false;
+    }
+}
+
+void RideRatingsInvalidateCache(const CoordsXY& loc)
+{
+    RideRatingsStopCachingWalks();
+    for (auto& ride : GetRideManager())
+    {
+        auto& cache = ride.ratingsCache;
+        if (cache.IsValid && loc.x >= cache.Result.WalkBoundsMin.x - kRideRatingsCacheMargin
+            && loc.x <= cache.Result.WalkBoundsMax.x + kRideRatingsCacheMargin
+            && loc.y >= cache.Result.WalkBoundsMin.y - kRideRatingsCacheMargin
+            && loc.y <= cache.Result.WalkBoundsMax.y + kRideRatingsCacheMargin)
+        {
+            cache.IsValid = false;
+        }
+    }
+}
+
+static void ride_ratings_update_state(RideRatingUpdateState& state, bool useCache)
+{
+    const auto previousState = state.State;
     switch (state.State)
     {
         case RIDE_RATINGS_STATE_FIND_NEXT_RIDE:
@@ -230,6 +362,14 @@ static void ride_ratings_update_state(RideRatingUpdateState& state)
         case RIDE_RATINGS_STATE_5:
             ride_ratings_update_state_5(state);
             break;
+        case RIDE_RATINGS_STATE_CACHED_WALK:
+            RideRatingsUpdateCachedWalk(state);
+            break;
+    }
+
+    if (IsProximityWalkState(previousState))
+    {
+        RideRatingsTrackWalk(state, previousState, useCache);
     }
 }
 
@@ -46,6 +46,8 @@ enum
     RIDE_RATING_STATION_FLAG_NO_ENTRANCE = 1 << 0
 };
 
+constexpr uint32_t kRideRatingWalkStepsUnknown = 0xFFFFFFFFu;
+
 struct RideRatingUpdateState
 {
     CoordsXYZ Proximity;
@@ -59,6 +61,25 @@ struct RideRatingUpdateState
     uint16_t AmountOfBrakes;
     uint16_t AmountOfReversers;
     uint16_t StationFlags;
+
+    // Bookkeeping of the proximity walk for RideRatingsCache, these are not saved. A walk that was in progress
+    // when the park was loaded is finished normally but not cached.
+    uint32_t WalkSteps{ kRideRatingWalkStepsUnknown };
+    CoordsXY WalkBoundsMin;
+    CoordsXY WalkBoundsMax;
+};
+
+/**
+ * The result of the last completed proximity walk of a ride (states RIDE_RATINGS_STATE_INITIALISE to
+ * RIDE_RATINGS_STATE_CALCULATE). While nothing on the map around the ride changes, the next walk of the ride only
+ * counts the same number of steps and then restores the cached result, so the ratings and the tick on which
+ * they change are identical to a full walk.
+ */
+struct RideRatingsCache
+{
+    bool IsValid{};
+    uint32_t NumSteps{};
+    RideRatingUpdateState Result{};
 };
 
 static constexpr size_t RideRatingMaxUpdateStates = 4;
@@ -69,6 +90,12 @@ void RideRatingResetUpdateStates();
 void RideRatingsUpdateRide(const Ride& ride);
 void RideRatingsUpdateAll();
 
+// Finishes the cached walks that are being counted down with real steps, needs to happen before the map is changed
+// or the update states are saved.
+void RideRatingsFlushCachedWalks();
+void RideRatingsInvalidateCache();
+void RideRatingsInvalidateCache(const CoordsXY& loc);
+
 // Special Track Element Adjustment functions for RTDs
 void SpecialTrackElementRatingsAjustment_Default(const Ride& ride, int32_t& excitement, int32_t& intensity, int32_t& nausea);
 void SpecialTrackElementRatingsAjustment_GhostTrain(const Ride& ride, int32_t& excitement, int32_t& intensity, int32_t& nausea);
@@ -0,0 +1,172 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TrackCircuitCache.h"
+
+#include "../config/Config.h"
+#include "../core/EnumUtils.hpp"
+
+#include <climits>
+#include <optional>
+#include <vector>
+
+namespace OpenRCT2::TrackCircuitCache
+{
+    static constexpr uint64_t kEmptyKey = ~0uLL;
+    static constexpr size_t kMinCapacity = 256;
+
+    static uint32_t _generation = 1;
+
+    // Open addressed table with linear probing, dropped lazily once the cache has been invalidated.
+    template<typename TValue>
+    class LinkTable
+    {
+        struct Slot
+        {
+            uint64_t Key = kEmptyKey;
+            TValue Value{};
+        };
+
+        std::vector<Slot> _slots;
+        size_t _count{};
+        uint32_t _generation{};
+
+        size_t FindSlot(uint64_t key) const
+        {
+            // Fibonacci hashing, as the keys of neighbouring pieces only differ in a few bits.
+            const auto mask = _slots.size() - 1;
+            auto pos = static_cast<size_t>((key * 0x9E3779B97F4A7C15uLL) >> 32) & mask;
+            while (_slots[pos].Key != key && _slots[pos].Key != kEmptyKey)
+            {
+                pos = (pos + 1) & mask;
+            }
+            return pos;
+        }
+
+        void Validate()
+        {
+            if (_generation == TrackCircuitCache::_generation)
+                return;
+
+            _slots.assign(kMinCapacity, Slot{});
+            _count = 0;
+            _generation = TrackCircuitCache::_generation;
+        }
+
+    public:
+        const TValue* Find(uint64_t key)
+        {
+            Validate();
+            const auto& slot = _slots[FindSlot(key)];
+            return slot.Key == kEmptyKey ? nullptr : &slot.Value;
+        }
+
+        void Set(uint64_t key, const TValue& value)
+        {
+            Validate();
+
+            // Keep the load factor at or below one half.
+            if ((_count + 1) * 2 > _slots.size())
+            {
+                auto oldSlots = std::move(_slots);
+                _slots.assign(oldSlots.size() * 2, Slot{});
+                for (const auto& slot : oldSlots)
+                {
+                    if (slot.Key != kEmptyKey)
+                    {
+                        _slots[FindSlot(slot.Key)] = slot;
+                    }
+                }
+            }
+
+            auto& slot = _slots[FindSlot(key)];
+            if (slot.Key == kEmptyKey)
+            {
+                _count++;
+            }
+            slot = { key, value };
+        }
+    };
+
+    static LinkTable<TileElement*> _origins;
+    static LinkTable<NextPiece> _next;
+    static LinkTable<TrackBeginEnd> _previous;
+
+    bool IsEnabled()
+    {
+        return Config::Get().general.CacheTrackCircuits;
+    }
+
+    void Invalidate()
+    {
+        _generation++;
+    }
+
+    // Packs a tile aligned position into a key, positions that do not fit are not cached.
+    static std::optional<uint64_t> GetKey(const CoordsXYZ& location, uint16_t extra, uint8_t direction)
+    {
+        if ((location.x & 31) != 0 || (location.y & 31) != 0 || location.x < 0 || location.y < 0
+            || location.x >= MAXIMUM_MAP_SIZE_BIG || location.y >= MAXIMUM_MAP_SIZE_BIG || location.z < INT16_MIN
+            || location.z > INT16_MAX)
+        {
+            return std::nullopt;
+        }
+
+        uint64_t key = static_cast<uint64_t>(location.x / kCoordsXYStep);
+        key = (key << 11) | static_cast<uint64_t>(location.y / kCoordsXYStep);
+        key = (key << 16) | static_cast<uint16_t>(location.z);
+        key = (key << 16) | extra;
+        key = (key << 3) | (direction & 7);
+        return key;
+    }
+
+    TileElement* GetOriginElement(const CoordsXYZ& location, TrackElemType trackType)
+    {
+        // Heights are compared in whole units, as MapGetTrackElementAtOfTypeSeq does.
+        const auto tileLocation = CoordsXYZ{ location.ToTileStart(), location.z / kCoordsZStep * kCoordsZStep };
+        const auto key = IsEnabled() ? GetKey(tileLocation, EnumValue(trackType), 0) : std::nullopt;
+        if (!key.has_value())
+            return MapGetTrackElementAtOfTypeSeq(location, trackType, 0);
+
+        if (const auto* origin = _origins.Find(*key))
+            return *origin;
+
+        auto* origin = MapGetTrackElementAtOfTypeSeq(location, trackType, 0);
+        _origins.Set(*key, origin);
+        return origin;
+    }
+
+    const NextPiece* FindNext(RideId rideIndex, const CoordsXYZ& startPos, uint8_t direction)
+    {
+        const auto key = GetKey(startPos, rideIndex.ToUnderlying(), direction);
+        return key.has_value() ? _next.Find(*key) : nullptr;
+    }
+
+    void SetNext(RideId rideIndex, const CoordsXYZ& startPos, uint8_t direction, const NextPiece& next)
+    {
+        if (const auto key = GetKey(startPos, rideIndex.ToUnderlying(), direction))
+        {
+            _next.Set(*key, next);
+        }
+    }
+
+    const TrackBeginEnd* FindPrevious(RideId rideIndex, const CoordsXYZ& startPos, uint8_t direction)
+    {
+        const auto key = GetKey(startPos, rideIndex.ToUnderlying(), direction);
+        return key.has_value() ? _previous.Find(*key) : nullptr;
+    }
+
+    void SetPrevious(RideId rideIndex, const CoordsXYZ& startPos, uint8_t direction, const TrackBeginEnd& previous)
+    {
+        if (const auto key = GetKey(startPos, rideIndex.ToUnderlying(), direction))
+        {
+            _previous.Set(*key, previous);
+        }
+    }
+} // namespace OpenRCT2::TrackCircuitCache
@@ -0,0 +1,53 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../world/Map.h"
+#include "Ride.h"
+#include "RideTypes.h"
+
+#include <cstdint>
+
+/**
+ * Cache of the links between track pieces, filled in by TrackBlockGetNextFromZero and TrackBlockGetPreviousFromZero
+ * as vehicles go round the circuit, and of the origin elements vehicles look up for the piece they are on. Once a
+ * train has been round once, moving onto the next piece costs a few probes of flat tables instead of tile scans.
+ *
+ * The links hold tile element pointers, which move whenever an element is inserted or removed anywhere on
+ * the map, so every change to the tile elements drops everything.
+ */
+namespace OpenRCT2::TrackCircuitCache
+{
+    // Result of TrackBlockGetNextFromZero for a search that found a tile to look at.
+    struct NextPiece
+    {
+        CoordsXYE Output{};
+        int32_t Z{};
+        int32_t Direction{};
+        bool Found{};
+    };
+
+    bool IsEnabled();
+
+    // Drops the cached links and origin elements.
+    void Invalidate();
+
+    // The element MapGetTrackElementAtOfTypeSeq finds for the first sequence of a piece, the tile is scanned when the
+    // cache is turned off.
+    TileElement* GetOriginElement(const CoordsXYZ& location, TrackElemType trackType);
+
+    // Links are keyed by the position and direction the search starts from.
+    const NextPiece* FindNext(RideId rideIndex, const CoordsXYZ& startPos, uint8_t direction);
+    void SetNext(RideId rideIndex, const CoordsXYZ& startPos, uint8_t direction, const NextPiece& next);
+
+    // Only pieces that were found are kept, a failed search leaves some of the caller's fields as they were.
+    const TrackBeginEnd* FindPrevious(RideId rideIndex, const CoordsXYZ& startPos, uint8_t direction);
+    void SetPrevious(RideId rideIndex, const CoordsXYZ& startPos, uint8_t direction, const TrackBeginEnd& previous);
+} // namespace OpenRCT2::TrackCircuitCache
@@ -58,6 +58,7 @@
 #include "RideData.h"
 #include "Station.h"
 #include "Track.h"
+#include "TrackCircuitCache.h"
 #include "TrackData.h"
 #include "TrainManager.h"
 #include "VehicleData.h"
@@ -6021,7 +6022,7 @@ void Vehicle::UpdateAnimationAnimalFlying()
     if (animation_frame == 0)
     {
         auto trackType = GetTrackType();
-        TileElement* trackElement = MapGetTrackElementAtOfTypeSeq(TrackLocation, trackType, 0);
+        TileElement* trackElement = TrackCircuitCache::GetOriginElement(TrackLocation, trackType);
         if (trackElement != nullptr && trackElement->AsTrack()->HasChain())
         {
             // start flapping, bird
@@ -6768,7 +6769,7 @@ void Vehicle::Sub6DBF3E()
     TileElement* tileElement = nullptr;
     if (MapIsLocationValid(TrackLocation))
     {
-        tileElement = MapGetTrackElementAtOfTypeSeq(TrackLocation, trackType, 0);
+        tileElement = TrackCircuitCache::GetOriginElement(TrackLocation, trackType);
     }
 
     if (tileElement == nullptr)
@@ -6844,7 +6845,7 @@ uint8_t Vehicle::ChooseBrakeSpeed() const
 {
     if (!TrackTypeIsBrakes(GetTrackType()))
         return brake_speed;
-    auto trackElement = MapGetTrackElementAtOfTypeSeq(TrackLocation, GetTrackType(), 0);
+    auto trackElement = TrackCircuitCache::GetOriginElement(TrackLocation, GetTrackType());
     if (trackElement != nullptr)
     {
         if (trackElement->AsTrack()->IsBrakeClosed())
@@ -6900,7 +6901,7 @@ bool Vehicle::UpdateTrackMotionForwardsGetNewTrack(
     CoordsXYZD location = {};
 
     auto pitchAndRollEnd = TrackPitchAndRollEnd(trackType);
-    TileElement* tileElement = MapGetTrackElementAtOfTypeSeq(TrackLocation, trackType, 0);
+    TileElement* tileElement = TrackCircuitCache::GetOriginElement(TrackLocation, trackType);
 
     if (tileElement == nullptr)
     {
@@ -7335,7 +7336,7 @@ static PitchAndRoll PitchAndRollEnd(
 bool Vehicle::UpdateTrackMotionBackwardsGetNewTrack(TrackElemType trackType, const Ride& curRide, uint16_t* progress)
 {
     auto pitchAndRollStart = TrackPitchAndRollStart(trackType);
-    TileElement* tileElement = MapGetTrackElementAtOfTypeSeq(TrackLocation, trackType, 0);
+    TileElement* tileElement = TrackCircuitCache::GetOriginElement(TrackLocation, trackType);
 
     if (tileElement == nullptr)
         return false;
@@ -7848,7 +7849,7 @@ Loc6DC462:
         uint16_t trackTotalProgress = GetTrackProgress();
         if (track_progress + 1 >= trackTotalProgress)
         {
-            tileElement = MapGetTrackElementAtOfTypeSeq(TrackLocation, GetTrackType(), 0);
+            tileElement = TrackCircuitCache::GetOriginElement(TrackLocation, GetTrackType());
             {
                 CoordsXYE output;
                 int32_t outZ{};
@@ -8043,7 +8044,7 @@ Loc6DC462:
 Loc6DCA9A:
     if (track_progress == 0)
     {
-        tileElement = MapGetTrackElementAtOfTypeSeq(TrackLocation, GetTrackType(), 0);
+        tileElement = TrackCircuitCache::GetOriginElement(TrackLocation, GetTrackType());
         {
             TrackBeginEnd trackBeginEnd;
             if (!TrackBlockGetPrevious({ TrackLocation, tileElement }, &trackBeginEnd))
@@ -8740,7 +8741,7 @@ void Vehicle::UpdateCrossings() const
     int32_t direction{};
 
     CoordsXYE xyElement = { frontVehicle->TrackLocation,
-                            MapGetTrackElementAtOfTypeSeq(frontVehicle->TrackLocation, frontVehicle->GetTrackType(), 0) };
+                            TrackCircuitCache::GetOriginElement(frontVehicle->TrackLocation, frontVehicle->GetTrackType()) };
     int32_t curZ = frontVehicle->TrackLocation.z;
 
     if (xyElement.element != nullptr && status != Vehicle::Status::Arriving)
@@ -8808,7 +8809,7 @@ void Vehicle::UpdateCrossings() const
     }
 
     xyElement = { backVehicle->TrackLocation,
-                  MapGetTrackElementAtOfTypeSeq(backVehicle->TrackLocation, backVehicle->GetTrackType(), 0) };
+                  TrackCircuitCache::GetOriginElement(backVehicle->TrackLocation, backVehicle->GetTrackType()) };
     if (xyElement.element == nullptr)
     {
         return;
@@ -1835,6 +1835,9 @@ void OpenRCT2::Scripting::ThrowIfGameStateNotMutable()
             duk_error(ctx, DUK_ERR_ERROR, "Game state is not mutable in this context.");
         }
     }
+
+    // Plugins change the park directly, so joining clients must not be sent a map saved before.
+    NetworkInvalidateCachedMaps();
 }
 
 int32_t OpenRCT2::Scripting::GetTargetAPIVersion()
@@ -126,6 +126,7 @@ namespace OpenRCT2::Scripting
                 }
             }
             MapInvalidateTileFull(_coords);
+            MapTileElementsChanged(_coords);
         }
     }
 
@@ -178,6 +179,7 @@ namespace OpenRCT2::Scripting
                 }
                 first[origNumElements].SetLastForTile(true);
                 MapInvalidateTileFull(_coords);
+                MapTileElementsChanged(_coords);
                 result = std::make_shared<ScTileElement>(_coords, &first[index]);
             }
         }
@@ -204,6 +206,7 @@ namespace OpenRCT2::Scripting
             }
             TileElementRemove(&first[index]);
             MapInvalidateTileFull(_coords);
+            MapTileElementsChanged(_coords);
         }
     }
 
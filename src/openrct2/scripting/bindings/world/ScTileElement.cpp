@@ -2153,6 +2153,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::Invalidate()
     {
         MapInvalidateTileFull(_coords);
+        MapTileElementsChanged(_coords);
     }
 
     const LargeSceneryElement* ScTileElement::GetOtherLargeSceneryElement(
@@ -30,6 +30,7 @@
 #include "../object/ObjectManager.h"
 #include "../object/PathAdditionEntry.h"
 #include "../paint/VirtualFloor.h"
+#include "../peep/PathCorridorIndex.h"
 #include "../ride/RideData.h"
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
@@ -1243,19 +1244,26 @@ int32_t FootpathIsConnectedToMapEdge(const CoordsXYZ& footpathPos, int32_t direc
  *
  *  rct2: 0x006A8B12
  *  clears the wide footpath flag for all footpaths
- *  at location
+ *  at location, returns which of the first 32 elements were wide
  */
-static void FootpathClearWide(const CoordsXY& footpathPos)
+static uint32_t FootpathClearWide(const CoordsXY& footpathPos)
 {
+    uint32_t wideElements = 0;
     TileElement* tileElement = MapGetFirstElementAt(footpathPos);
     if (tileElement == nullptr)
-        return;
+        return wideElements;
+    uint32_t index = 0;
     do
     {
-        if (tileElement->GetType() != TileElementType::Path)
-            continue;
-        tileElement->AsPath()->SetWide(false);
+        if (tileElement->GetType() == TileElementType::Path)
+        {
+            if (tileElement->AsPath()->IsWide() && index < 32)
+                wideElements |= 1u << index;
+            tileElement->AsPath()->SetWide(false);
+        }
+        index++;
     } while (!(tileElement++)->IsLastForTile());
+    return wideElements;
 }
 
 /**
@@ -1294,7 +1302,7 @@ void FootpathUpdatePathWideFlags(const CoordsXY& footpathPos)
     if (MapIsLocationAtEdge(footpathPos))
         return;
 
-    FootpathClearWide(footpathPos);
+    const auto wideElements = FootpathClearWide(footpathPos);
     /* Rather than clearing the wide flag of the following tiles and
      * checking the state of them later, leave them intact and assume
      * they were cleared. Consequently only the wide flag for this single
@@ -1484,7 +1492,14 @@ void FootpathUpdatePathWideFlags(const CoordsXY& footpathPos)
         {
             uint8_t e = tileElement->AsPath()->GetEdgesAndCorners();
             if ((e != 0b10101111) && (e != 0b01011111) && (e != 0b11101111))
+            {
                 tileElement->AsPath()->SetWide(true);
+
+                // Paths that become wide are no longer walked through as corridors.
+                const auto index = tileElement - MapGetFirstElementAt(footpathPos);
+                if (index >= 32 || !(wideElements & (1u << index)))
+                    PathCorridorIndex::Invalidate(footpathPos);
+            }
         }
     } while (!(tileElement++)->IsLastForTile());
 }
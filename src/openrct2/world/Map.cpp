@@ -38,11 +38,16 @@
 #include "../object/ObjectManager.h"
 #include "../object/SmallSceneryEntry.h"
 #include "../object/TerrainSurfaceObject.h"
+#include "../paint/PaintCache.h"
+#include "../peep/PathCorridorIndex.h"
 #include "../profiling/Profiling.h"
 #include "../ride/RideConstruction.h"
 #include "../ride/RideData.h"
 #include "../ride/RideManager.hpp"
+#include "../ride/RideProximityIndex.h"
+#include "../ride/RideRatings.h"
 #include "../ride/Track.h"
+#include "../ride/TrackCircuitCache.h"
 #include "../ride/TrackData.h"
 #include "../ride/TrackDesign.h"
 #include "../scenario/Scenario.h"
@@ -116,6 +121,13 @@ static TileCoordsXY _mapSizeStash;
 
 void StashMap()
 {
+    // Cached rating walks have to be replayed on the map they were recorded on.
+    RideRatingsFlushCachedWalks();
+    RideProximityIndex::Invalidate();
+    PathCorridorIndex::Invalidate();
+    TrackCircuitCache::Invalidate();
+    PaintCache::Invalidate();
+
     auto& gameState = GetGameState();
     _tileIndexStash = std::move(_tileIndex);
     _tileElementsStash = std::move(gameState.TileElements);
@@ -130,6 +142,11 @@ void UnstashMap()
     gameState.TileElements = std::move(_tileElementsStash);
     gameState.MapSize = _mapSizeStash;
     _tileElementsInUse = _tileElementsInUseStash;
+    RideProximityIndex::Invalidate();
+    PathCorridorIndex::Invalidate();
+    TrackCircuitCache::Invalidate();
+    PaintCache::Invalidate();
+    NetworkInvalidateCachedMaps();
 }
 
 CoordsXY GetMapSizeUnits()
@@ -159,6 +176,10 @@ void SetTileElements(GameState_t& gameState, std::vector<TileElement>&& tileElem
     _tileIndex = TilePointerIndex<TileElement>(
         kMaximumMapSizeTechnical, gameState.TileElements.data(), gameState.TileElements.size());
     _tileElementsInUse = gameState.TileElements.size();
+    RideProximityIndex::Invalidate();
+    PathCorridorIndex::Invalidate();
+    TrackCircuitCache::Invalidate();
+    PaintCache::Invalidate();
 }
 
 static TileElement GetDefaultSurfaceElement()
@@ -1028,6 +1049,9 @@ bool MapIsLocationAtEdge(const CoordsXY& loc)
  */
 void TileElementRemove(TileElement* tileElement)
 {
+    TrackCircuitCache::Invalidate();
+    PaintCache::Invalidate();
+
     // Replace Nth element by (N+1)th element.
     // This loop will make tileElement point to the old last element position,
     // after copy it to it's new position
@@ -1184,6 +1208,10 @@ static TileElement* AllocateTileElements(size_t numElementsOnTile, size_t numNew
  */
 TileElement* TileElementInsert(const CoordsXYZ& loc, int32_t occupiedQuadrants, TileElementType type)
 {
+    // The elements of the tile are moved to a new block.
+    TrackCircuitCache::Invalidate();
+    PaintCache::Invalidate();
+
     const auto& tileLoc = TileCoordsXYZ(loc);
 
     auto numElementsOnTileOld = CountElementsOnTile(loc);
@@ -1735,6 +1763,8 @@ bool MapLargeScenerySignSetColour(const CoordsXYZD& signPos, int32_t sequence, u
 
 static void MapInvalidateTileUnderZoom(int32_t x, int32_t y, int32_t z0, int32_t z1, ZoomLevel maxZoom)
 {
+    PaintCache::Invalidate({ x, y });
+
     if (gOpenRCT2Headless)
         return;
 
@@ -1784,6 +1814,8 @@ void MapInvalidateElement(const CoordsXY& elementPos, TileElement* tileElement)
 
 void MapInvalidateRegion(const CoordsXY& mins, const CoordsXY& maxs)
 {
+    PaintCache::Invalidate(mins, maxs);
+
     int32_t x0, y0, x1, y1, left, right, top, bottom;
 
     x0 = mins.x + 16;
@@ -1802,6 +1834,25 @@ void MapInvalidateRegion(const CoordsXY& mins, const CoordsXY& maxs)
     ViewportsInvalidate({ { left, top }, { right, bottom } });
 }
 
+void MapTileElementsChanged(const CoordsXY& loc)
+{
+    RideRatingsInvalidateCache(loc);
+    RideProximityIndex::Invalidate(loc);
+    PathCorridorIndex::Invalidate(loc);
+    TrackCircuitCache::Invalidate();
+    PaintCache::Invalidate(loc);
+    NetworkInvalidateCachedMaps();
+}
+
+void MapTileElementsChanged()
+{
+    RideRatingsInvalidateCache();
+    RideProximityIndex::Invalidate();
+    PathCorridorIndex::Invalidate();
+    TrackCircuitCache::Invalidate();
+    PaintCache::Invalidate();
+}
+
 int32_t MapGetTileSide(const CoordsXY& mapPos)
 {
     int32_t subMapX = mapPos.x & (32 - 1);
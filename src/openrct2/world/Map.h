@@ -227,6 +227,10 @@ void MapInvalidateTileFull(const CoordsXY& tilePos);
 void MapInvalidateElement(const CoordsXY& elementPos, TileElement* tileElement);
 void MapInvalidateRegion(const CoordsXY& mins, const CoordsXY& maxs);
 
+// Drops the data cached from the tile elements around a location, or the whole map, after they were changed.
+void MapTileElementsChanged(const CoordsXY& loc);
+void MapTileElementsChanged();
+
 int32_t MapGetTileSide(const CoordsXY& mapPos);
 int32_t MapGetTileQuadrant(const CoordsXY& mapPos);
 int32_t MapGetCornerHeight(int32_t z, int32_t slope, int32_t direction);
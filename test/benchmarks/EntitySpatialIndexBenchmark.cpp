@@ -0,0 +1,132 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <openrct2/core/Algorithm.hpp>
+#include <openrct2/entity/EntitySpatialIndex.h>
+#include <openrct2/world/Map.h>
+#include <random>
+#include <vector>
+
+// The layout EntitySpatialIndex replaced, one vector per tile of the largest possible map.
+class LegacySpatialIndex
+{
+    static constexpr uint32_t kSize = (kMaximumMapSizeTechnical * kMaximumMapSizeTechnical) + 1;
+
+    std::unique_ptr<std::array<std::vector<EntityId>, kSize>> _buckets = std::make_unique<
+        std::array<std::vector<EntityId>, kSize>>();
+
+public:
+    const std::vector<EntityId>& Get(uint32_t key) const
+    {
+        return (*_buckets)[key];
+    }
+
+    void Insert(uint32_t key, EntityId id)
+    {
+        auto& vec = (*_buckets)[key];
+        vec.insert(std::lower_bound(std::begin(vec), std::end(vec), id), id);
+    }
+
+    bool Remove(uint32_t key, EntityId id)
+    {
+        auto& vec = (*_buckets)[key];
+        auto it = BinaryFind(std::begin(vec), std::end(vec), id);
+        if (it == std::end(vec))
+            return false;
+        vec.erase(it);
+        return true;
+    }
+};
+
+static constexpr int32_t kMapSize = 256;
+
+static uint32_t RandomTile(std::mt19937& rng)
+{
+    std::uniform_int_distribution<int32_t> dist(1, kMapSize - 2);
+    return dist(rng) * kMaximumMapSizeTechnical + dist(rng);
+}
+
+// A tile next to the given one in x or y, staying inside the map.
+static uint32_t NeighbouringTile(std::mt19937& rng, uint32_t key)
+{
+    auto x = static_cast<int32_t>(key / kMaximumMapSizeTechnical);
+    auto y = static_cast<int32_t>(key % kMaximumMapSizeTechnical);
+    const auto step = (rng() & 1) ? 1 : -1;
+    if (rng() & 2)
+        x = std::clamp(x + step, 1, kMapSize - 2);
+    else
+        y = std::clamp(y + step, 1, kMapSize - 2);
+    return x * kMaximumMapSizeTechnical + y;
+}
+
+template<typename TIndex>
+static void Populate(TIndex& index, std::vector<uint32_t>& keys, int64_t numEntities)
+{
+    std::mt19937 rng(42);
+    keys.resize(numEntities);
+    for (int64_t i = 0; i < numEntities; i++)
+    {
+        keys[i] = RandomTile(rng);
+        index.Insert(keys[i], EntityId::FromUnderlying(static_cast<uint16_t>(i)));
+    }
+}
+
+template<typename TIndex>
+static void BM_SpatialIndexLookup(benchmark::State& state)
+{
+    TIndex index;
+    std::vector<uint32_t> keys;
+    Populate(index, keys, state.range(0));
+
+    std::mt19937 rng(1);
+    std::vector<uint32_t> queries(4096);
+    std::generate(queries.begin(), queries.end(), [&]() { return RandomTile(rng); });
+
+    for (auto _ : state)
+    {
+        size_t found = 0;
+        for (auto key : queries)
+        {
+            found += index.Get(key).size();
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * queries.size());
+}
+
+template<typename TIndex>
+static void BM_SpatialIndexUpdate(benchmark::State& state)
+{
+    TIndex index;
+    std::vector<uint32_t> keys;
+    Populate(index, keys, state.range(0));
+
+    // Every entity steps onto a neighbouring tile, like walking guests do.
+    std::mt19937 rng(1);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < keys.size(); i++)
+        {
+            const auto id = EntityId::FromUnderlying(static_cast<uint16_t>(i));
+            index.Remove(keys[i], id);
+            keys[i] = NeighbouringTile(rng, keys[i]);
+            index.Insert(keys[i], id);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+BENCHMARK_TEMPLATE(BM_SpatialIndexLookup, LegacySpatialIndex)->Arg(1000)->Arg(30000);
+BENCHMARK_TEMPLATE(BM_SpatialIndexLookup, EntitySpatialIndex)->Arg(1000)->Arg(30000);
+BENCHMARK_TEMPLATE(BM_SpatialIndexUpdate, LegacySpatialIndex)->Arg(1000)->Arg(30000);
+BENCHMARK_TEMPLATE(BM_SpatialIndexUpdate, EntitySpatialIndex)->Arg(1000)->Arg(30000);
@@ -0,0 +1,185 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+    #include <benchmark/benchmark.h>
+    #include <memory>
+    #include <openrct2/network/NetworkConnection.h>
+    #include <openrct2/network/NetworkPacket.h>
+    #include <openrct2/network/Socket.h>
+    #include <vector>
+
+static constexpr uint16_t kLoopbackPort = 11760;
+
+// A listening socket on the loopback address with the given number of clients connected to it.
+class LoopbackServer
+{
+    std::unique_ptr<ITcpSocket> _listener;
+    std::vector<std::unique_ptr<ITcpSocket>> _clients;
+
+public:
+    std::vector<std::unique_ptr<NetworkConnection>> Connections;
+
+    explicit LoopbackServer(int64_t numClients)
+    {
+        _listener = CreateTcpSocket();
+        _listener->Listen("127.0.0.1", kLoopbackPort);
+        for (int64_t i = 0; i < numClients; i++)
+        {
+            auto client = CreateTcpSocket();
+            client->Connect("127.0.0.1", kLoopbackPort);
+            _clients.push_back(std::move(client));
+
+            std::unique_ptr<ITcpSocket> socket;
+            while (socket == nullptr)
+            {
+                socket = _listener->Accept();
+            }
+            auto connection = std::make_unique<NetworkConnection>();
+            connection->Socket = std::move(socket);
+            connection->AuthStatus = NetworkAuth::Ok;
+            Connections.push_back(std::move(connection));
+        }
+    }
+
+    // Reads everything the clients received so the socket buffers never fill up.
+    void Drain()
+    {
+        static uint8_t buffer[64 * 1024];
+        for (auto& client : _clients)
+        {
+            size_t received = 0;
+            while (client->ReceiveData(buffer, sizeof(buffer), &received) == NetworkReadPacket::Success && received > 0)
+            {
+            }
+        }
+    }
+};
+
+// Connecting a client takes a while, so the clients are only connected once and each benchmark uses the first
+// of them. The server listens on a fixed port, so there can only be one.
+static constexpr int64_t kMaxClients = 64;
+
+static LoopbackServer& GetLoopbackServer()
+{
+    static LoopbackServer server(kMaxClients);
+    return server;
+}
+
+// What a server sends every tick of a busy game: the tick itself and a few game actions.
+static std::vector<NetworkPacket> CreateTickPackets()
+{
+    std::vector<NetworkPacket> packets;
+
+    NetworkPacket tick(NetworkCommand::Tick);
+    tick << uint32_t{ 1000 } << uint32_t{ 0x12345678 } << uint32_t{ 0 };
+    packets.push_back(std::move(tick));
+
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        NetworkPacket action(NetworkCommand::GameAction);
+        action << uint32_t{ 1000 } << i << uint8_t{ 1 } << i;
+        for (uint32_t j = 0; j < 16; j++)
+        {
+            action << j;
+        }
+        packets.push_back(std::move(action));
+    }
+    return packets;
+}
+
+// How connections sent packets before they were queued as shared buffers: every connection serialises the packet
+// into its own flat buffer, which is sent in one go and has the sent bytes erased from its front.
+static void BM_SendPacketFlatBuffer(benchmark::State& state)
+{
+    auto& server = GetLoopbackServer();
+    const auto numClients = static_cast<size_t>(state.range(0));
+    const auto packets = CreateTickPackets();
+    std::vector<std::vector<uint8_t>> outboundBuffers(numClients);
+    for (auto _ : state)
+    {
+        for (const auto& packet : packets)
+        {
+            for (auto& outboundBuffer : outboundBuffers)
+            {
+                const auto payload = NetworkConnection::SerialisePacket(packet);
+                outboundBuffer.insert(outboundBuffer.end(), payload->begin(), payload->end());
+            }
+        }
+        for (size_t i = 0; i < numClients; i++)
+        {
+            auto& outboundBuffer = outboundBuffers[i];
+            const auto bytesSent = server.Connections[i]->Socket->SendData(outboundBuffer.data(), outboundBuffer.size());
+            outboundBuffer.erase(outboundBuffer.begin(), outboundBuffer.begin() + bytesSent);
+        }
+
+        state.PauseTiming();
+        server.Drain();
+        state.ResumeTiming();
+    }
+}
+
+static void BM_SendPacketCopyPerConnection(benchmark::State& state)
+{
+    auto& server = GetLoopbackServer();
+    const auto numClients = static_cast<size_t>(state.range(0));
+    const auto packets = CreateTickPackets();
+    for (auto _ : state)
+    {
+        for (const auto& packet : packets)
+        {
+            for (size_t i = 0; i < numClients; i++)
+            {
+                server.Connections[i]->QueuePacket(packet);
+            }
+        }
+        for (size_t i = 0; i < numClients; i++)
+        {
+            server.Connections[i]->SendQueuedData();
+        }
+
+        state.PauseTiming();
+        server.Drain();
+        state.ResumeTiming();
+    }
+}
+
+static void BM_SendPacketShared(benchmark::State& state)
+{
+    auto& server = GetLoopbackServer();
+    const auto numClients = static_cast<size_t>(state.range(0));
+    const auto packets = CreateTickPackets();
+    for (auto _ : state)
+    {
+        for (const auto& packet : packets)
+        {
+            auto buffer = NetworkConnection::SerialisePacket(packet);
+            for (size_t i = 0; i < numClients; i++)
+            {
+                server.Connections[i]->QueuePacket(packet, buffer);
+            }
+        }
+        for (size_t i = 0; i < numClients; i++)
+        {
+            server.Connections[i]->SendQueuedData();
+        }
+
+        state.PauseTiming();
+        server.Drain();
+        state.ResumeTiming();
+    }
+}
+
+// Server CPU time per tick by the number of connected clients.
+BENCHMARK(BM_SendPacketFlatBuffer)->Arg(1)->Arg(8)->Arg(32)->Arg(kMaxClients);
+BENCHMARK(BM_SendPacketCopyPerConnection)->Arg(1)->Arg(8)->Arg(32)->Arg(kMaxClients);
+BENCHMARK(BM_SendPacketShared)->Arg(1)->Arg(8)->Arg(32)->Arg(kMaxClients);
+
+#endif // DISABLE_NETWORK
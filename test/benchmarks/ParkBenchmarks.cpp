@@ -0,0 +1,392 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/GameState.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/ParkImporter.h>
+#include <openrct2/config/Config.h>
+#include <openrct2/core/MemoryStream.h>
+#include <openrct2/core/Numerics.hpp>
+#include <openrct2/core/Path.hpp>
+#include <openrct2/core/TaskScheduler.h>
+#include <openrct2/drawing/X8DrawingEngine.h>
+#include <openrct2/entity/EntityList.h>
+#include <openrct2/entity/EntityRegistry.h>
+#include <openrct2/entity/Guest.h>
+#include <openrct2/interface/Viewport.h>
+#include <openrct2/object/ObjectManager.h>
+#include <openrct2/paint/Paint.h>
+#include <openrct2/paint/PaintCache.h>
+#include <openrct2/park/ParkFile.h>
+#include <openrct2/peep/GuestPathfinding.h>
+#include <openrct2/ride/Ride.h>
+#include <openrct2/ride/RideManager.hpp>
+#include <openrct2/ride/RideRatings.h>
+#include <openrct2/ride/Vehicle.h>
+#include <utility>
+#include <vector>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Drawing;
+
+// Parks from the test data, selected by the first argument of each benchmark.
+static constexpr std::array kParks = {
+    "bpb.sv6",
+    "small_park_with_ferris_wheel.sv6",
+    "pathfinding-tests.sv6",
+};
+
+static constexpr int32_t kViewWidth = 1920;
+static constexpr int32_t kViewHeight = 1080;
+
+// One context for all benchmarks, with the graphics loaded so the paint benchmarks have sprites to look up.
+static IContext* GetBenchmarkContext()
+{
+    static std::unique_ptr<IContext> context;
+    static bool initialised = false;
+    if (context == nullptr)
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = false;
+        context = CreateContext();
+        initialised = context->Initialise();
+    }
+    return initialised ? context.get() : nullptr;
+}
+
+class ParkFixture : public benchmark::Fixture
+{
+public:
+    void SetUp(benchmark::State& state) override
+    {
+        auto* context = GetBenchmarkContext();
+        if (context == nullptr)
+        {
+            state.SkipWithError("Unable to initialise the context");
+            return;
+        }
+
+        const auto* name = kParks[state.range(0)];
+        if (!context->LoadParkFromFile(Path::Combine(OPENRCT2_BENCHMARK_PARKS_PATH, name)))
+        {
+            state.SkipWithError("Unable to load the park");
+            return;
+        }
+        GameLoadInit();
+        state.SetLabel(name);
+    }
+
+protected:
+    // The saved view of the park, as used for a screenshot of it.
+    static Viewport CreateSavedViewport(ZoomLevel zoom = ZoomLevel{ 0 })
+    {
+        const auto& gameState = GetGameState();
+
+        Viewport viewport{};
+        viewport.width = kViewWidth;
+        viewport.height = kViewHeight;
+        viewport.zoom = zoom;
+        viewport.viewPos = { gameState.SavedView
+                             - ScreenCoordsXY{ (viewport.ViewWidth() / 2), (viewport.ViewHeight() / 2) } };
+        viewport.rotation = gameState.SavedViewRotation;
+        return viewport;
+    }
+
+    // Generates the paint structs of every column of the viewport, the same way ViewportPaint splits it.
+    static std::vector<PaintSession*> GenerateColumns(const Viewport& viewport)
+    {
+        DrawPixelInfo dpi;
+        dpi.x = viewport.zoom.ApplyInversedTo(viewport.viewPos.x);
+        dpi.y = viewport.zoom.ApplyInversedTo(viewport.viewPos.y);
+        dpi.width = viewport.width;
+        dpi.height = viewport.height;
+        dpi.zoom_level = viewport.zoom;
+
+        const int32_t columnWidth = viewport.zoom.ApplyInversedTo(kCoordsXYStep);
+        std::vector<PaintSession*> sessions;
+        for (int32_t x = Numerics::floor2(dpi.x, columnWidth); x < dpi.x + dpi.width; x += columnWidth)
+        {
+            auto* session = PaintSessionAlloc(dpi, viewport.flags, viewport.rotation);
+            auto& columnDpi = session->DPI;
+            columnDpi.x = std::max(x, dpi.x);
+            columnDpi.width = std::min(x + columnWidth, dpi.x + dpi.width) - columnDpi.x;
+            PaintSessionGenerate(*session);
+            sessions.push_back(session);
+        }
+        return sessions;
+    }
+
+    // Sorts the columns of the saved view at the zoom level of the second argument, only the sorting is timed.
+    static void BenchmarkArrange(benchmark::State& state, TaskScheduler* jobs)
+    {
+        const auto viewport = CreateSavedViewport(ZoomLevel{ static_cast<int8_t>(state.range(1)) });
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            auto sessions = GenerateColumns(viewport);
+            state.ResumeTiming();
+
+            for (auto* session : sessions)
+            {
+                PaintSessionArrange(*session, jobs);
+            }
+
+            state.PauseTiming();
+            for (auto* session : sessions)
+            {
+                PaintSessionFree(session);
+            }
+            state.ResumeTiming();
+        }
+    }
+};
+
+BENCHMARK_DEFINE_F(ParkFixture, GameStateUpdateLogic)(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        gameStateUpdateLogic();
+    }
+}
+
+BENCHMARK_DEFINE_F(ParkFixture, GetAllEntitiesChecksum)(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto checksum = GetAllEntitiesChecksum();
+        benchmark::DoNotOptimize(checksum);
+    }
+}
+
+// Checksum taken after every tick, by hashing every entity or, with the second argument, only the changed ones.
+BENCHMARK_DEFINE_F(ParkFixture, GetAllEntitiesChecksumPerTick)(benchmark::State& state)
+{
+    const bool incremental = state.range(1) != 0;
+    ResetEntityChecksumCache();
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        gameStateUpdateLogic();
+        state.ResumeTiming();
+
+        auto checksum = incremental ? GetAllEntitiesIncrementalChecksum() : GetAllEntitiesChecksum();
+        benchmark::DoNotOptimize(checksum);
+    }
+}
+
+BENCHMARK_DEFINE_F(ParkFixture, PaintSessionArrange)(benchmark::State& state)
+{
+    BenchmarkArrange(state, nullptr);
+}
+
+BENCHMARK_DEFINE_F(ParkFixture, PaintSessionArrangeStable)(benchmark::State& state)
+{
+    gPaintStableSort = true;
+    BenchmarkArrange(state, nullptr);
+    gPaintStableSort = false;
+}
+
+BENCHMARK_DEFINE_F(ParkFixture, PaintSessionArrangeArray)(benchmark::State& state)
+{
+    Config::Get().general.ArrayPaintSort = true;
+    BenchmarkArrange(state, nullptr);
+    Config::Get().general.ArrayPaintSort = false;
+}
+
+BENCHMARK_DEFINE_F(ParkFixture, PaintSessionArrangeArrayParallel)(benchmark::State& state)
+{
+    Config::Get().general.ArrayPaintSort = true;
+    BenchmarkArrange(state, &TaskScheduler::GetShared());
+    Config::Get().general.ArrayPaintSort = false;
+}
+
+BENCHMARK_DEFINE_F(ParkFixture, ViewportRender)(benchmark::State& state)
+{
+    if (state.error_occurred())
+        return;
+
+    const auto viewport = CreateSavedViewport();
+    std::vector<uint8_t> pixels(static_cast<size_t>(viewport.width) * viewport.height);
+    X8DrawingEngine drawingEngine(GetContext()->GetUiContext());
+
+    DrawPixelInfo dpi;
+    dpi.bits = pixels.data();
+    dpi.width = viewport.width;
+    dpi.height = viewport.height;
+    dpi.DrawingEngine = &drawingEngine;
+
+    for (auto _ : state)
+    {
+        ViewportRender(dpi, &viewport);
+    }
+    state.SetItemsProcessed(state.iterations() * pixels.size());
+}
+
+BENCHMARK_DEFINE_F(ParkFixture, ViewportRenderCached)(benchmark::State& state)
+{
+    if (state.error_occurred())
+        return;
+
+    const auto viewport = CreateSavedViewport();
+    std::vector<uint8_t> pixels(static_cast<size_t>(viewport.width) * viewport.height);
+    X8DrawingEngine drawingEngine(GetContext()->GetUiContext());
+
+    DrawPixelInfo dpi;
+    dpi.bits = pixels.data();
+    dpi.width = viewport.width;
+    dpi.height = viewport.height;
+    dpi.DrawingEngine = &drawingEngine;
+
+    // The first frame fills the cache, the following ones only paint the entities and the uncached tiles.
+    Config::Get().general.CachePaintColumns = true;
+    PaintCache::Invalidate();
+    ViewportRender(dpi, &viewport);
+    for (auto _ : state)
+    {
+        ViewportRender(dpi, &viewport);
+    }
+    Config::Get().general.CachePaintColumns = false;
+    state.SetItemsProcessed(state.iterations() * pixels.size());
+}
+
+// Saves the park, compressed in parallel blocks when the second argument is set.
+BENCHMARK_DEFINE_F(ParkFixture, ParkFileSave)(benchmark::State& state)
+{
+    if (state.error_occurred())
+        return;
+
+    ParkFileExporter exporter;
+    exporter.ExportObjectsList = GetContext()->GetObjectManager().GetPackableObjects();
+    Config::Get().general.ParallelParkCompression = state.range(1) != 0;
+    for (auto _ : state)
+    {
+        MemoryStream stream;
+        exporter.Export(GetGameState(), stream);
+        benchmark::DoNotOptimize(stream.GetLength());
+    }
+    Config::Get().general.ParallelParkCompression = false;
+}
+
+// Loads a save of the park, compressed in parallel blocks when the second argument is set.
+BENCHMARK_DEFINE_F(ParkFixture, ParkFileLoad)(benchmark::State& state)
+{
+    if (state.error_occurred())
+        return;
+
+    auto* context = GetContext();
+    MemoryStream saved;
+    ParkFileExporter exporter;
+    exporter.ExportObjectsList = context->GetObjectManager().GetPackableObjects();
+    Config::Get().general.ParallelParkCompression = state.range(1) != 0;
+    exporter.Export(GetGameState(), saved);
+    Config::Get().general.ParallelParkCompression = false;
+
+    for (auto _ : state)
+    {
+        saved.SetPosition(0);
+        auto importer = ParkImporter::CreateParkFile(context->GetObjectRepository());
+        auto loadResult = importer->LoadFromStream(&saved, false);
+        context->GetObjectManager().LoadObjects(loadResult.RequiredObjects);
+        importer->Import(GetGameState());
+    }
+    state.SetBytesProcessed(state.iterations() * saved.GetLength());
+}
+
+BENCHMARK_DEFINE_F(ParkFixture, RideRatingsUpdateRide)(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        for (auto& ride : GetRideManager())
+        {
+            RideRatingsUpdateRide(ride);
+        }
+    }
+}
+
+// Moves every train once a tick, with the track circuit cache turned on by the second argument.
+BENCHMARK_DEFINE_F(ParkFixture, VehicleUpdateAll)(benchmark::State& state)
+{
+    Config::Get().general.CacheTrackCircuits = state.range(1) != 0;
+    for (auto _ : state)
+    {
+        VehicleUpdateAll();
+    }
+    Config::Get().general.CacheTrackCircuits = false;
+}
+
+BENCHMARK_DEFINE_F(ParkFixture, PeepPathfindHeuristicSearch)(benchmark::State& state)
+{
+    if (state.error_occurred())
+        return;
+
+    std::vector<const Ride*> destinations;
+    for (auto& ride : GetRideManager())
+    {
+        if (!ride.GetStation().Entrance.IsNull())
+        {
+            destinations.push_back(&ride);
+        }
+    }
+
+    // Walking guests inside the park, each heading to one of the rides in turn.
+    std::vector<std::pair<Guest*, const Ride*>> searches;
+    for (auto* guest : EntityList<Guest>())
+    {
+        if (destinations.empty() || searches.size() >= 256)
+            break;
+        if (guest->State != PeepState::Walking || guest->OutsideOfPark)
+            continue;
+        searches.emplace_back(guest, destinations[searches.size() % destinations.size()]);
+    }
+    if (searches.empty())
+    {
+        state.SkipWithError("No walking guests or rides with an entrance");
+        return;
+    }
+
+    for (auto _ : state)
+    {
+        for (auto& [guest, ride] : searches)
+        {
+            guest->GuestHeadingToRideId = ride->id;
+            const auto goal = TileCoordsXYZ{ ride->GetStation().Entrance };
+            auto direction = PathFinding::ChooseDirection(
+                TileCoordsXYZ{ guest->NextLoc }, goal, *guest, false, RideId::GetNull());
+            benchmark::DoNotOptimize(direction);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * searches.size());
+}
+
+BENCHMARK_REGISTER_F(ParkFixture, GameStateUpdateLogic)->DenseRange(0, 1)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ParkFixture, GetAllEntitiesChecksum)->DenseRange(0, 1)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(ParkFixture, GetAllEntitiesChecksumPerTick)
+    ->ArgsProduct({ { 0, 1 }, { 0, 1 } })
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(ParkFixture, PaintSessionArrange)->ArgsProduct({ { 0, 1 }, { 0, 2 } })->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ParkFixture, PaintSessionArrangeStable)
+    ->ArgsProduct({ { 0, 1 }, { 0, 2 } })
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ParkFixture, PaintSessionArrangeArray)->ArgsProduct({ { 0, 1 }, { 0, 2 } })->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ParkFixture, PaintSessionArrangeArrayParallel)
+    ->ArgsProduct({ { 0, 1 }, { 0, 2 } })
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ParkFixture, ViewportRender)->DenseRange(0, 1)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ParkFixture, ViewportRenderCached)->DenseRange(0, 1)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ParkFixture, ParkFileSave)->ArgsProduct({ { 0, 1 }, { 0, 1 } })->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ParkFixture, ParkFileLoad)->ArgsProduct({ { 0, 1 }, { 0, 1 } })->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ParkFixture, RideRatingsUpdateRide)->DenseRange(0, 1)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(ParkFixture, VehicleUpdateAll)->ArgsProduct({ { 0, 1 }, { 0, 1 } })->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(ParkFixture, PeepPathfindHeuristicSearch)->DenseRange(0, 2)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,78 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <openrct2/core/JobPool.h>
+#include <openrct2/core/TaskScheduler.h>
+
+using namespace OpenRCT2;
+
+// Roughly the amount of work of filling a small paint column.
+static void SmallWork(std::atomic<uint32_t>& sink)
+{
+    uint32_t value = 0;
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        benchmark::DoNotOptimize(value += i * i);
+    }
+    sink.fetch_add(value, std::memory_order_relaxed);
+}
+
+static void BM_JobPoolThroughput(benchmark::State& state)
+{
+    JobPool pool;
+    std::atomic<uint32_t> sink{};
+    for (auto _ : state)
+    {
+        for (int64_t i = 0; i < state.range(0); i++)
+        {
+            pool.AddTask([&sink]() { SmallWork(sink); });
+        }
+        pool.Join();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_TaskSchedulerThroughput(benchmark::State& state)
+{
+    TaskScheduler scheduler;
+    std::atomic<uint32_t> sink{};
+    for (auto _ : state)
+    {
+        TaskGroup group(scheduler);
+        for (int64_t i = 0; i < state.range(0); i++)
+        {
+            group.Run([&sink]() { SmallWork(sink); });
+        }
+        group.Wait();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_TaskSchedulerParallelFor(benchmark::State& state)
+{
+    TaskScheduler scheduler;
+    std::atomic<uint32_t> sink{};
+    for (auto _ : state)
+    {
+        scheduler.ParallelFor(0, state.range(0), 1, [&sink](size_t first, size_t last) {
+            for (auto i = first; i < last; i++)
+            {
+                SmallWork(sink);
+            }
+        });
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// A viewport is split into 32 pixel columns, so a 4K screen gives about 120 tasks per frame.
+BENCHMARK(BM_JobPoolThroughput)->Arg(128)->Arg(4096)->UseRealTime();
+BENCHMARK(BM_TaskSchedulerThroughput)->Arg(128)->Arg(4096)->UseRealTime();
+BENCHMARK(BM_TaskSchedulerParallelFor)->Arg(128)->Arg(4096)->UseRealTime();
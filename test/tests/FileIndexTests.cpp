@@ -0,0 +1,142 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/core/File.h>
+#include <openrct2/core/FileIndex.hpp>
+#include <openrct2/core/Path.hpp>
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+
+// Indexes the contents of text files, counting how many files it had to read.
+class TextFileIndex final : public FileIndex<std::string>
+{
+public:
+    mutable std::atomic<int32_t> NumCreated{};
+
+    TextFileIndex(const std::string& directory)
+        : FileIndex(
+              "text file index", 0x58455454, 1, Path::Combine(directory, u8"index.idx"), "*.txt",
+              std::vector<std::string>{ directory })
+    {
+    }
+
+protected:
+    std::optional<std::string> Create(int32_t, const std::string& path) const override
+    {
+        NumCreated++;
+        auto text = File::ReadAllText(path);
+        if (text == "invalid")
+            return std::nullopt;
+        return text;
+    }
+
+    void Serialise(DataSerialiser& ds, const std::string& item) const override
+    {
+        ds << item;
+    }
+};
+
+class FileIndexTests : public testing::Test
+{
+protected:
+    std::string _directory;
+
+    static void SetUpTestCase()
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        // Building reports its progress to the context.
+        _context = CreateContext();
+    }
+
+    static void TearDownTestCase()
+    {
+        _context.reset();
+    }
+
+    void SetUp() override
+    {
+        _directory = Path::Combine(std::filesystem::temp_directory_path().string(), u8"openrct2-file-index-test");
+        Path::DeleteDirectory(_directory);
+        Path::CreateDirectory(_directory);
+    }
+
+    void TearDown() override
+    {
+        Path::DeleteDirectory(_directory);
+    }
+
+    void WriteFile(const std::string& name, const std::string& text)
+    {
+        File::WriteAllBytes(Path::Combine(_directory, name), text.data(), text.size());
+    }
+
+    static std::vector<std::string> Sorted(std::vector<std::string> items)
+    {
+        std::sort(items.begin(), items.end());
+        return items;
+    }
+
+private:
+    static std::unique_ptr<IContext> _context;
+};
+
+std::unique_ptr<IContext> FileIndexTests::_context;
+
+TEST_F(FileIndexTests, OnlyChangedFilesAreCreated)
+{
+    WriteFile(u8"a.txt", "a");
+    WriteFile(u8"b.txt", "b");
+    WriteFile(u8"c.txt", "c");
+    WriteFile(u8"d.txt", "invalid");
+    {
+        TextFileIndex index(_directory);
+        ASSERT_EQ(Sorted(index.LoadOrBuild(0)), (std::vector<std::string>{ "a", "b", "c" }));
+        ASSERT_EQ(index.NumCreated.load(), 4);
+    }
+
+    // Nothing changed, everything comes from the index, including that d.txt has no item.
+    {
+        TextFileIndex index(_directory);
+        ASSERT_EQ(Sorted(index.LoadOrBuild(0)), (std::vector<std::string>{ "a", "b", "c" }));
+        ASSERT_EQ(index.NumCreated.load(), 0);
+    }
+
+    // One file added, one changed and one removed.
+    WriteFile(u8"e.txt", "e");
+    WriteFile(u8"b.txt", "bb");
+    File::Delete(Path::Combine(_directory, u8"c.txt"));
+    {
+        TextFileIndex index(_directory);
+        ASSERT_EQ(Sorted(index.LoadOrBuild(0)), (std::vector<std::string>{ "a", "bb", "e" }));
+        ASSERT_EQ(index.NumCreated.load(), 2);
+    }
+
+    // Another language can not reuse the items.
+    {
+        TextFileIndex index(_directory);
+        ASSERT_EQ(Sorted(index.LoadOrBuild(1)), (std::vector<std::string>{ "a", "bb", "e" }));
+        ASSERT_EQ(index.NumCreated.load(), 4);
+    }
+
+    {
+        TextFileIndex index(_directory);
+        ASSERT_EQ(Sorted(index.Rebuild(1)), (std::vector<std::string>{ "a", "bb", "e" }));
+        ASSERT_EQ(index.NumCreated.load(), 4);
+    }
+}
@@ -0,0 +1,77 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <array>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <openrct2/core/File.h>
+#include <openrct2/core/Imaging.h>
+#include <openrct2/core/Path.hpp>
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class ImagingTests : public testing::Test
+{
+protected:
+    std::string _path;
+
+    void SetUp() override
+    {
+        _path = Path::Combine(std::filesystem::temp_directory_path().string(), u8"openrct2-row-writer.png");
+    }
+
+    void TearDown() override
+    {
+        File::Delete(_path);
+    }
+};
+
+TEST_F(ImagingTests, png_row_writer_round_trip)
+{
+    // An odd width and rows padded out to a wider stride, as the bands of a screenshot are not.
+    constexpr uint32_t kWidth = 37;
+    constexpr uint32_t kHeight = 100;
+    constexpr uint32_t kStride = 40;
+    std::vector<uint8_t> pixels(kStride * kHeight);
+    for (size_t i = 0; i < pixels.size(); i++)
+    {
+        pixels[i] = static_cast<uint8_t>(i * 31 + (i >> 5));
+    }
+
+    Image header;
+    header.Width = kWidth;
+    header.Height = kHeight;
+    header.Depth = 8;
+    header.Palette = Drawing::GamePalette{};
+    auto writer = Imaging::CreatePngRowWriter(_path, header);
+    uint32_t y = 0;
+    for (uint32_t numRows : std::array<uint32_t, 4>{ 1, 7, 30, 62 })
+    {
+        writer->WriteRows(pixels.data() + y * kStride, numRows, kStride);
+        y += numRows;
+    }
+    ASSERT_EQ(y, kHeight);
+    writer->Finish();
+    writer.reset();
+
+    const auto image = Imaging::ReadFromFile(_path, IMAGE_FORMAT::PNG);
+    ASSERT_EQ(image.Width, kWidth);
+    ASSERT_EQ(image.Height, kHeight);
+    ASSERT_EQ(image.Depth, 8u);
+    ASSERT_EQ(image.Stride, kWidth);
+    for (uint32_t row = 0; row < kHeight; row++)
+    {
+        const auto* expected = pixels.data() + row * kStride;
+        const auto* actual = image.Pixels.data() + row * image.Stride;
+        ASSERT_EQ(std::vector<uint8_t>(actual, actual + kWidth), std::vector<uint8_t>(expected, expected + kWidth))
+            << "row " << row;
+    }
+}
@@ -0,0 +1,63 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <openrct2/core/File.h>
+#include <openrct2/core/IStream.hpp>
+#include <openrct2/core/MemoryMappedFile.h>
+#include <openrct2/core/Path.hpp>
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class MemoryMappedFileTests : public testing::Test
+{
+protected:
+    std::string _path;
+
+    void SetUp() override
+    {
+        _path = Path::Combine(std::filesystem::temp_directory_path().string(), u8"openrct2-mapped-file.dat");
+    }
+
+    void TearDown() override
+    {
+        File::Delete(_path);
+    }
+};
+
+TEST_F(MemoryMappedFileTests, maps_whole_file)
+{
+    // Spans several pages and does not end on a page boundary.
+    std::vector<uint8_t> contents(3 * 4096 + 123);
+    for (size_t i = 0; i < contents.size(); i++)
+    {
+        contents[i] = static_cast<uint8_t>(i * 7 + (i >> 8));
+    }
+    File::WriteAllBytes(_path, contents.data(), contents.size());
+
+    MemoryMappedFile file(_path);
+    ASSERT_NE(file.GetData(), nullptr);
+    ASSERT_EQ(file.GetSize(), contents.size());
+    ASSERT_EQ(std::vector<uint8_t>(file.GetData(), file.GetData() + file.GetSize()), contents);
+}
+
+TEST_F(MemoryMappedFileTests, missing_file_throws)
+{
+    File::Delete(_path);
+    ASSERT_THROW(MemoryMappedFile file(_path), IOException);
+}
+
+TEST_F(MemoryMappedFileTests, empty_file_throws)
+{
+    File::WriteAllBytes(_path, nullptr, 0);
+    ASSERT_THROW(MemoryMappedFile file(_path), IOException);
+}
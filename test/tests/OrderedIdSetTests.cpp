@@ -0,0 +1,123 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/Identifiers.h>
+#include <openrct2/core/OrderedIdSet.hpp>
+#include <set>
+#include <vector>
+
+using namespace OpenRCT2;
+
+using TestIdSet = OrderedIdSet<EntityId, 65535>;
+
+static std::vector<uint16_t> ToVector(const TestIdSet& set)
+{
+    std::vector<uint16_t> res;
+    for (auto id : set)
+    {
+        res.push_back(id.ToUnderlying());
+    }
+    return res;
+}
+
+TEST(OrderedIdSetTest, empty)
+{
+    TestIdSet set;
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(set.size(), 0u);
+    ASSERT_TRUE(set.begin() == set.end());
+    ASSERT_EQ(set.FindNext(0), TestIdSet::npos);
+}
+
+TEST(OrderedIdSetTest, iterates_in_ascending_order)
+{
+    TestIdSet set;
+    for (uint16_t id : { 65534, 5, 4096, 63, 64, 0, 4095, 12000 })
+    {
+        ASSERT_TRUE(set.insert(EntityId::FromUnderlying(id)));
+    }
+    ASSERT_FALSE(set.insert(EntityId::FromUnderlying(64)));
+    ASSERT_EQ(set.size(), 8u);
+    ASSERT_EQ(ToVector(set), (std::vector<uint16_t>{ 0, 5, 63, 64, 4095, 4096, 12000, 65534 }));
+    ASSERT_EQ(set.front(), EntityId::FromUnderlying(0));
+}
+
+TEST(OrderedIdSetTest, erase)
+{
+    TestIdSet set;
+    set.insert(EntityId::FromUnderlying(10));
+    set.insert(EntityId::FromUnderlying(20000));
+    ASSERT_TRUE(set.erase(EntityId::FromUnderlying(10)));
+    ASSERT_FALSE(set.erase(EntityId::FromUnderlying(10)));
+    ASSERT_FALSE(set.contains(EntityId::FromUnderlying(10)));
+    ASSERT_TRUE(set.contains(EntityId::FromUnderlying(20000)));
+    ASSERT_EQ(set.front(), EntityId::FromUnderlying(20000));
+    ASSERT_EQ(set.size(), 1u);
+    ASSERT_FALSE(set.contains(EntityId::GetNull()));
+}
+
+TEST(OrderedIdSetTest, fill)
+{
+    TestIdSet set;
+    set.fill();
+    ASSERT_EQ(set.size(), 65535u);
+    ASSERT_TRUE(set.contains(EntityId::FromUnderlying(65534)));
+    ASSERT_FALSE(set.contains(EntityId::GetNull()));
+    ASSERT_EQ(set.front(), EntityId::FromUnderlying(0));
+
+    size_t count = 0;
+    for ([[maybe_unused]] auto id : set)
+    {
+        count++;
+    }
+    ASSERT_EQ(count, 65535u);
+}
+
+TEST(OrderedIdSetTest, erase_while_iterating)
+{
+    TestIdSet set;
+    for (uint16_t id = 0; id < 1000; id += 3)
+    {
+        set.insert(EntityId::FromUnderlying(id));
+    }
+    for (auto id : set)
+    {
+        if (id.ToUnderlying() % 2 == 0)
+        {
+            set.erase(id);
+        }
+    }
+    for (auto id : set)
+    {
+        ASSERT_EQ(id.ToUnderlying() % 2, 1);
+    }
+}
+
+TEST(OrderedIdSetTest, matches_std_set)
+{
+    TestIdSet set;
+    std::set<uint16_t> reference;
+    uint32_t seed = 12345;
+    for (int i = 0; i < 20000; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        const auto id = static_cast<uint16_t>((seed >> 8) % 65535);
+        if (seed & 0x80000000u)
+        {
+            ASSERT_EQ(set.insert(EntityId::FromUnderlying(id)), reference.insert(id).second);
+        }
+        else
+        {
+            ASSERT_EQ(set.erase(EntityId::FromUnderlying(id)), reference.erase(id) != 0);
+        }
+    }
+    ASSERT_EQ(set.size(), reference.size());
+    ASSERT_EQ(ToVector(set), std::vector<uint16_t>(reference.begin(), reference.end()));
+}
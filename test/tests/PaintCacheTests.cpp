@@ -0,0 +1,155 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/GameState.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/config/Config.h>
+#include <openrct2/drawing/X8DrawingEngine.h>
+#include <openrct2/interface/Viewport.h>
+#include <openrct2/paint/PaintCache.h>
+#include <openrct2/world/Map.h>
+#include <openrct2/world/tile_element/SurfaceElement.h>
+#include <optional>
+#include <vector>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Drawing;
+
+class PaintCacheTests : public testing::Test
+{
+protected:
+    static constexpr int32_t kViewWidth = 640;
+    static constexpr int32_t kViewHeight = 480;
+
+    static std::unique_ptr<IContext> _context;
+
+    static void SetUpTestSuite()
+    {
+        // The graphics are loaded so the renders have sprites to compare.
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = false;
+        _context = CreateContext();
+        if (!_context->Initialise() || !_context->LoadParkFromFile(TestData::GetParkPath("bpb.sv6")))
+        {
+            _context.reset();
+            return;
+        }
+        GameLoadInit();
+    }
+
+    static void TearDownTestSuite()
+    {
+        _context.reset();
+    }
+
+    void TearDown() override
+    {
+        Config::Get().general.CachePaintColumns = false;
+        PaintCache::Invalidate();
+    }
+
+    // The saved view of the park, as used for a screenshot of it.
+    static Viewport CreateSavedViewport()
+    {
+        const auto& gameState = GetGameState();
+
+        Viewport viewport{};
+        viewport.width = kViewWidth;
+        viewport.height = kViewHeight;
+        viewport.viewPos = { gameState.SavedView
+                             - ScreenCoordsXY{ (viewport.ViewWidth() / 2), (viewport.ViewHeight() / 2) } };
+        viewport.rotation = gameState.SavedViewRotation;
+        return viewport;
+    }
+
+    static std::vector<uint8_t> Render(const Viewport& viewport, bool useCache)
+    {
+        std::vector<uint8_t> pixels(static_cast<size_t>(viewport.width) * viewport.height);
+        X8DrawingEngine drawingEngine(_context->GetUiContext());
+
+        DrawPixelInfo dpi;
+        dpi.bits = pixels.data();
+        dpi.width = viewport.width;
+        dpi.height = viewport.height;
+        dpi.DrawingEngine = &drawingEngine;
+
+        Config::Get().general.CachePaintColumns = useCache;
+        ViewportRender(dpi, &viewport);
+        Config::Get().general.CachePaintColumns = false;
+        return pixels;
+    }
+
+    // A dry tile with nothing but its surface, drawn well inside the viewport.
+    static std::optional<CoordsXY> FindBareTileInView(const Viewport& viewport)
+    {
+        const auto& mapSize = GetGameState().MapSize;
+        for (int32_t y = 1; y < mapSize.y - 1; y++)
+        {
+            for (int32_t x = 1; x < mapSize.x - 1; x++)
+            {
+                const auto loc = TileCoordsXY{ x, y }.ToCoordsXY();
+                const auto* surface = MapGetSurfaceElementAt(loc);
+                if (surface == nullptr || !surface->IsLastForTile()
+                    || MapGetFirstElementAt(loc) != reinterpret_cast<const TileElement*>(surface)
+                    || surface->GetWaterHeight() > 0)
+                {
+                    continue;
+                }
+
+                const auto screenPos = Translate3DTo2DWithZ(
+                    viewport.rotation, { loc.ToTileCentre(), surface->GetBaseZ() });
+                if (screenPos.x >= viewport.viewPos.x + 64 && screenPos.x < viewport.viewPos.x + viewport.ViewWidth() - 64
+                    && screenPos.y >= viewport.viewPos.y + 64 && screenPos.y < viewport.viewPos.y + viewport.ViewHeight() - 64)
+                {
+                    return loc;
+                }
+            }
+        }
+        return std::nullopt;
+    }
+};
+
+std::unique_ptr<IContext> PaintCacheTests::_context;
+
+TEST_F(PaintCacheTests, cached_render_matches_uncached_render)
+{
+    ASSERT_NE(_context, nullptr);
+
+    const auto viewport = CreateSavedViewport();
+    const auto uncached = Render(viewport, false);
+
+    // The first render records the columns, the second replays them.
+    PaintCache::Invalidate();
+    ASSERT_TRUE(Render(viewport, true) == uncached);
+    ASSERT_TRUE(Render(viewport, true) == uncached);
+
+    const auto loc = FindBareTileInView(viewport);
+    ASSERT_TRUE(loc.has_value());
+    auto* surface = MapGetSurfaceElementAt(*loc);
+    surface->SetWaterHeight(surface->GetBaseZ() + 2 * WATER_HEIGHT_STEP);
+
+    // Without an invalidation the tile is replayed as it was recorded, which shows the replay is used at all.
+    ASSERT_TRUE(Render(viewport, true) == uncached);
+    const auto flooded = Render(viewport, false);
+    ASSERT_FALSE(flooded == uncached);
+
+    MapInvalidateTileFull(*loc);
+    ASSERT_TRUE(Render(viewport, true) == flooded);
+    ASSERT_TRUE(Render(viewport, true) == flooded);
+
+    surface->SetWaterHeight(0);
+    MapInvalidateTileFull(*loc);
+    ASSERT_TRUE(Render(viewport, true) == uncached);
+}
@@ -0,0 +1,92 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/config/Config.h>
+#include <openrct2/core/TaskScheduler.h>
+#include <openrct2/paint/Paint.h>
+#include <random>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class PaintSortTest : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        gPaintStableSort = false;
+        Config::Get().general.ArrayPaintSort = false;
+    }
+
+    // Random structs spread over the quadrants, every third quadrant left empty when sparse is set.
+    static std::vector<PaintStruct> CreateStructs(std::mt19937& rng, size_t count, uint16_t numQuadrants, bool sparse)
+    {
+        std::vector<PaintStruct> structs(count);
+        for (auto& ps : structs)
+        {
+            ps = {};
+            const auto quadrant = static_cast<uint16_t>(rng() % numQuadrants);
+            const auto x = static_cast<int32_t>(quadrant * 16 + rng() % 64);
+            const auto y = static_cast<int32_t>(quadrant * 16 + rng() % 64);
+            const auto z = static_cast<int32_t>(rng() % 200);
+            ps.Bounds = { x, y, z, x + static_cast<int32_t>(rng() % 40), y + static_cast<int32_t>(rng() % 40),
+                          z + static_cast<int32_t>(rng() % 60) };
+            ps.QuadrantIndex = sparse ? quadrant * 3 : quadrant;
+        }
+        return structs;
+    }
+
+    // Arranges a copy of the structs and returns their indices in drawing order.
+    static std::vector<size_t> Arrange(std::vector<PaintStruct> structs, uint8_t rotation, TaskScheduler* jobs)
+    {
+        auto session = std::make_unique<PaintSessionCore>();
+        session->CurrentRotation = rotation;
+        session->QuadrantBackIndex = UINT32_MAX;
+        for (auto& ps : structs)
+        {
+            ps.NextQuadrantEntry = session->Quadrants[ps.QuadrantIndex];
+            session->Quadrants[ps.QuadrantIndex] = &ps;
+            session->QuadrantBackIndex = std::min<uint32_t>(session->QuadrantBackIndex, ps.QuadrantIndex);
+            session->QuadrantFrontIndex = std::max<uint32_t>(session->QuadrantFrontIndex, ps.QuadrantIndex);
+        }
+
+        PaintSessionArrange(*session, jobs);
+
+        std::vector<size_t> order;
+        for (auto* ps = session->PaintHead; ps != nullptr; ps = ps->NextQuadrantEntry)
+        {
+            order.push_back(ps - structs.data());
+        }
+        return order;
+    }
+};
+
+TEST_F(PaintSortTest, array_sort_matches_stable_sort)
+{
+    TaskScheduler jobs(4);
+    std::mt19937 rng(1234);
+    for (int i = 0; i < 200; i++)
+    {
+        const auto rotation = static_cast<uint8_t>(i % 4);
+        const auto count = static_cast<size_t>(1 + rng() % (i % 5 == 0 ? 4000 : 300));
+        const auto structs = CreateStructs(rng, count, static_cast<uint16_t>(1 + rng() % 200), i % 3 == 0);
+
+        gPaintStableSort = true;
+        Config::Get().general.ArrayPaintSort = false;
+        const auto expected = Arrange(structs, rotation, nullptr);
+        ASSERT_EQ(expected.size(), structs.size());
+
+        Config::Get().general.ArrayPaintSort = true;
+        ASSERT_EQ(Arrange(structs, rotation, nullptr), expected);
+        ASSERT_EQ(Arrange(structs, rotation, &jobs), expected);
+    }
+}
@@ -17,25 +17,40 @@
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/ParkImporter.h>
 #include <openrct2/actions/ParkSetEntranceFeeAction.h>
+#include <openrct2/actions/ParkSetNameAction.h>
 #include <openrct2/actions/ParkSetParameterAction.h>
 #include <openrct2/actions/RideSetPriceAction.h>
 #include <openrct2/actions/RideSetStatusAction.h>
+#include <openrct2/config/Config.h>
+#include <openrct2/entity/EntityList.h>
 #include <openrct2/entity/EntityRegistry.h>
 #include <openrct2/entity/EntityTweener.h>
 #include <openrct2/entity/Peep.h>
+#include <openrct2/network/NetworkBase.h>
 #include <openrct2/object/ObjectManager.h>
 #include <openrct2/platform/Platform.h>
 #include <openrct2/ride/Ride.h>
 #include <openrct2/ride/RideManager.hpp>
+#include <openrct2/world/Map.h>
 #include <openrct2/world/MapAnimation.h>
 #include <openrct2/world/Park.h>
 #include <openrct2/world/Scenery.h>
+#include <openrct2/world/tile_element/SurfaceElement.h>
 #include <string>
 
 using namespace OpenRCT2;
 
 class PlayTests : public testing::Test
 {
+protected:
+    void TearDown() override
+    {
+        // Options are restored here so a failed assertion does not leave them on for the following tests.
+        auto& general = Config::Get().general;
+        general.GuestHotStateMirror = false;
+        general.CachePathCorridors = false;
+        general.CacheTrackCircuits = false;
+    }
 };
 
 static std::unique_ptr<IContext> localStartGame(const std::string& parkPath)
@@ -198,3 +213,143 @@ TEST_F(PlayTests, CarRideWithOneCarOnlyAcceptsTwoGuests)
         gameStateUpdateLogic();
     }
 }
+
+// Runs the park for a while with the given option set and returns the entity checksum.
+static std::string runWithOption(const std::string& parkPath, bool Config::General::* option, bool value)
+{
+    Config::Get().general.*option = value;
+
+    auto context = localStartGame(parkPath);
+    if (context == nullptr)
+        return {};
+
+    for (int i = 0; i < 2000; i++)
+    {
+        gameStateUpdateLogic();
+    }
+
+    return GetAllEntitiesChecksum().ToString();
+}
+
+TEST_F(PlayTests, GuestHotStateMirrorMatchesEntityUpdate)
+{
+    // Guests ticked from the mirror must be written back into exactly the state the full update leaves them in
+    std::string parkPath = TestData::GetParkPath("bpb.sv6");
+
+    auto unmirrored = runWithOption(parkPath, &Config::General::GuestHotStateMirror, false);
+    auto mirrored = runWithOption(parkPath, &Config::General::GuestHotStateMirror, true);
+    ASSERT_FALSE(unmirrored.empty());
+    ASSERT_EQ(unmirrored, mirrored);
+}
+
+TEST_F(PlayTests, PathCorridorIndexMatchesTileSearch)
+{
+    // Walking the cached corridors must lead the guests and staff along exactly the same paths
+    std::string parkPath = TestData::GetParkPath("bpb.sv6");
+
+    auto uncached = runWithOption(parkPath, &Config::General::CachePathCorridors, false);
+    auto cached = runWithOption(parkPath, &Config::General::CachePathCorridors, true);
+    ASSERT_FALSE(uncached.empty());
+    ASSERT_EQ(uncached, cached);
+}
+
+TEST_F(PlayTests, TrackCircuitCacheMatchesTileSearch)
+{
+    // Trains following the cached track links must end up exactly where the tile scans take them
+    std::string parkPath = TestData::GetParkPath("bpb.sv6");
+
+    auto uncached = runWithOption(parkPath, &Config::General::CacheTrackCircuits, false);
+    auto cached = runWithOption(parkPath, &Config::General::CacheTrackCircuits, true);
+    ASSERT_FALSE(uncached.empty());
+    ASSERT_EQ(uncached, cached);
+}
+
+TEST_F(PlayTests, IncrementalChecksumDoesNotDependOnHistory)
+{
+    // Reusing the hashes of unchanged entities must give the same checksum as hashing every entity again
+    std::string parkPath = TestData::GetParkPath("bpb.sv6");
+    auto context = localStartGame(parkPath);
+    ASSERT_NE(context.get(), nullptr);
+
+    for (int i = 0; i < 500; i++)
+    {
+        gameStateUpdateLogic();
+        GetAllEntitiesIncrementalChecksum();
+    }
+    auto incremental = GetAllEntitiesIncrementalChecksum().ToString();
+
+    ResetEntityChecksumCache();
+    auto fromScratch = GetAllEntitiesIncrementalChecksum().ToString();
+
+    ASSERT_EQ(incremental, fromScratch);
+}
+
+TEST_F(PlayTests, IncrementalChecksumSeesChangedEntity)
+{
+    std::string parkPath = TestData::GetParkPath("bpb.sv6");
+    auto context = localStartGame(parkPath);
+    ASSERT_NE(context.get(), nullptr);
+
+    auto* guest = *EntityList<Guest>().begin();
+    ASSERT_NE(guest, nullptr);
+
+    auto before = GetAllEntitiesIncrementalChecksum().ToString();
+    guest->Energy++;
+    auto changed = GetAllEntitiesIncrementalChecksum().ToString();
+    guest->Energy--;
+    auto restored = GetAllEntitiesIncrementalChecksum().ToString();
+
+    ASSERT_NE(before, changed);
+    ASSERT_EQ(before, restored);
+}
+
+#ifndef DISABLE_NETWORK
+TEST_F(PlayTests, CachedMapIsSharedUntilGameAction)
+{
+    std::string parkPath = TestData::GetParkPath("bpb.sv6");
+    auto context = localStartGame(parkPath);
+    ASSERT_NE(context.get(), nullptr);
+
+    auto& network = context->GetNetwork();
+    const auto objects = context->GetObjectManager().GetPackableObjects();
+
+    // Two clients joining on the same tick are sent the same saved map.
+    const auto& firstJoin = network.GetCachedMapForNetwork(objects);
+    const auto firstData = firstJoin;
+    const auto& secondJoin = network.GetCachedMapForNetwork(objects);
+    ASSERT_FALSE(firstData.empty());
+    ASSERT_EQ(&firstJoin, &secondJoin);
+    ASSERT_EQ(firstData, secondJoin);
+
+    // Sending a game action on to the clients drops the map, so the next client gets the renamed park.
+    ParkSetNameAction action("Cached Map Park");
+    ASSERT_EQ(GameActions::Execute(&action).Error, GameActions::Status::Ok);
+    network.ServerSendGameAction(&action);
+    const auto& thirdJoin = network.GetCachedMapForNetwork(objects);
+    ASSERT_FALSE(thirdJoin.empty());
+    ASSERT_NE(firstData, thirdJoin);
+}
+
+TEST_F(PlayTests, CachedMapIsDroppedByDirectTileChanges)
+{
+    std::string parkPath = TestData::GetParkPath("bpb.sv6");
+    auto context = localStartGame(parkPath);
+    ASSERT_NE(context.get(), nullptr);
+
+    auto& network = context->GetNetwork();
+    const auto objects = context->GetObjectManager().GetPackableObjects();
+    const auto firstData = network.GetCachedMapForNetwork(objects);
+    ASSERT_FALSE(firstData.empty());
+
+    // Plugins and console commands edit tiles without a game action, within the same tick.
+    const auto loc = CoordsXY{ 2 * kCoordsXYStep, 2 * kCoordsXYStep };
+    auto* surface = MapGetSurfaceElementAt(loc);
+    ASSERT_NE(surface, nullptr);
+    surface->SetWaterHeight(surface->GetBaseZ() + 2 * WATER_HEIGHT_STEP);
+    MapTileElementsChanged(loc);
+
+    const auto& nextJoin = network.GetCachedMapForNetwork(objects);
+    ASSERT_FALSE(nextJoin.empty());
+    ASSERT_NE(firstData, nextJoin);
+}
+#endif
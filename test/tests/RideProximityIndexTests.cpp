@@ -0,0 +1,140 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/GameState.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/actions/RideDemolishAction.h>
+#include <openrct2/ride/Ride.h>
+#include <openrct2/ride/RideManager.hpp>
+#include <openrct2/ride/RideProximityIndex.h>
+#include <openrct2/world/Map.h>
+#include <openrct2/world/TileElementsView.h>
+#include <openrct2/world/tile_element/TrackElement.h>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class RideProximityIndexTests : public testing::Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        _context = CreateContext();
+        bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        GetContext()->LoadParkFromFile(TestData::GetParkPath("bpb.sv6"));
+        GameLoadInit();
+    }
+
+    static void TearDownTestCase()
+    {
+        _context.reset();
+    }
+
+    // Same scan as guests do without the index.
+    static RideProximityIndex::RideSet ScanRidesInRange(const TileCoordsXY& min, const TileCoordsXY& max)
+    {
+        RideProximityIndex::RideSet rides;
+        for (int32_t y = min.y; y <= max.y; y++)
+        {
+            for (int32_t x = min.x; x <= max.x; x++)
+            {
+                const auto location = TileCoordsXY{ x, y }.ToCoordsXY();
+                if (!MapIsLocationValid(location))
+                    continue;
+
+                for (auto* trackElement : TileElementsView<TrackElement>(location))
+                {
+                    if (!trackElement->GetRideIndex().IsNull())
+                    {
+                        rides[trackElement->GetRideIndex().ToUnderlying()] = true;
+                    }
+                }
+            }
+        }
+        return rides;
+    }
+
+    static std::vector<size_t> ToIndices(const RideProximityIndex::RideSet& rides)
+    {
+        std::vector<size_t> indices;
+        for (size_t i = 0; i < rides.size(); i++)
+        {
+            if (rides[i])
+            {
+                indices.push_back(i);
+            }
+        }
+        return indices;
+    }
+
+    static void CheckAllRanges()
+    {
+        constexpr int32_t kRadius = 10;
+        const auto mapSize = GetGameState().MapSize;
+        for (int32_t y = -kRadius; y < mapSize.y + kRadius; y += 3)
+        {
+            for (int32_t x = -kRadius; x < mapSize.x + kRadius; x += 3)
+            {
+                const TileCoordsXY min{ x - kRadius, y - kRadius };
+                const TileCoordsXY max{ x + kRadius, y + kRadius };
+
+                RideProximityIndex::RideSet rides;
+                RideProximityIndex::AddRidesInRange(min, max, rides);
+                ASSERT_EQ(ToIndices(rides), ToIndices(ScanRidesInRange(min, max))) << "at " << x << ", " << y;
+            }
+        }
+    }
+
+private:
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> RideProximityIndexTests::_context;
+
+TEST_F(RideProximityIndexTests, MatchesTileScan)
+{
+    CheckAllRanges();
+}
+
+TEST_F(RideProximityIndexTests, MatchesTileScanAfterDemolish)
+{
+    // Build the index before the track is removed
+    CheckAllRanges();
+
+    const auto rideId = (*GetRideManager().begin()).id;
+    auto action = RideDemolishAction(rideId, RIDE_MODIFY_DEMOLISH);
+    ASSERT_EQ(GameActions::Execute(&action).Error, GameActions::Status::Ok);
+    ASSERT_EQ(GetRide(rideId), nullptr);
+
+    CheckAllRanges();
+}
+
+TEST_F(RideProximityIndexTests, LandmarkRidesCachedDuringGuestUpdate)
+{
+    RideProximityIndex::RideSet uncached;
+    RideProximityIndex::AddLandmarkRides(uncached);
+    ASSERT_GT(uncached.count(), 0u);
+
+    RideProximityIndex::BeginGuestUpdate();
+    RideProximityIndex::RideSet cached;
+    RideProximityIndex::AddLandmarkRides(cached);
+    RideProximityIndex::EndGuestUpdate();
+
+    ASSERT_EQ(ToIndices(cached), ToIndices(uncached));
+}
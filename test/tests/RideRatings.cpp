@@ -12,16 +12,20 @@
 #include <gtest/gtest.h>
 #include <openrct2/Context.h>
 #include <openrct2/Game.h>
+#include <openrct2/GameState.h>
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/audio/AudioContext.h>
+#include <openrct2/config/Config.h>
 #include <openrct2/core/File.h>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
+#include <openrct2/entity/EntityRegistry.h>
 #include <openrct2/platform/Platform.h>
 #include <openrct2/ride/Ride.h>
 #include <openrct2/ride/RideData.h>
 #include <openrct2/ride/RideManager.hpp>
 #include <string>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -89,6 +93,48 @@ protected:
             expI++;
         }
     }
+
+    // Runs the park and returns the ratings and values of all rides, followed by the entity checksum.
+    std::vector<std::string> SimulateRatings(const u8string& parkFile, bool incremental, int32_t& numCachedRides)
+    {
+        Config::Get().general.IncrementalRideRatings = incremental;
+
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+
+        std::vector<std::string> result;
+        auto context = CreateContext();
+        if (!context->Initialise() || !context->LoadParkFromFile(TestData::GetParkPath(parkFile)))
+        {
+            Config::Get().general.IncrementalRideRatings = false;
+            return result;
+        }
+
+        for (int32_t i = 0; i < 3000; i++)
+        {
+            if (i == 1000)
+            {
+                // Drop the cached walks around one ride while other walks are being counted.
+                const auto& ride = *GetRideManager().begin();
+                RideRatingsInvalidateCache(ride.GetStation().GetStart());
+            }
+            gameStateUpdateLogic();
+        }
+
+        numCachedRides = 0;
+        for (const auto& ride : GetRideManager())
+        {
+            result.push_back(FormatRatings(ride) + String::stdFormat(" value %lld", static_cast<long long>(ride.value)));
+            if (ride.ratingsCache.IsValid)
+            {
+                numCachedRides++;
+            }
+        }
+        result.push_back(GetAllEntitiesChecksum().ToString());
+
+        Config::Get().general.IncrementalRideRatings = false;
+        return result;
+    }
 };
 
 TEST_F(RideRatings, bpb)
@@ -105,3 +151,17 @@ TEST_F(RideRatings, EverythingPark)
 {
     TestRatings("EverythingPark.park", 529);
 }
+
+TEST_F(RideRatings, IncrementalMatchesFullSweep)
+{
+    // Skipping the walks of unchanged rides must give the same ratings on the same ticks
+    int32_t numCachedRides = 0;
+    auto fullSweep = SimulateRatings("bpb.sv6", false, numCachedRides);
+    ASSERT_EQ(numCachedRides, 0);
+
+    auto incremental = SimulateRatings("bpb.sv6", true, numCachedRides);
+    ASSERT_GT(numCachedRides, 0);
+
+    ASSERT_FALSE(fullSweep.empty());
+    ASSERT_EQ(fullSweep, incremental);
+}
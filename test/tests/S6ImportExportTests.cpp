@@ -19,9 +19,11 @@
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/ParkImporter.h>
 #include <openrct2/audio/AudioContext.h>
+#include <openrct2/config/Config.h>
 #include <openrct2/core/Crypt.h>
 #include <openrct2/core/File.h>
 #include <openrct2/core/MemoryStream.h>
+#include <openrct2/core/OrcaStream.hpp>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
 #include <openrct2/entity/EntityRegistry.h>
@@ -35,6 +37,10 @@
 #include <openrct2/scenario/Scenario.h>
 #include <openrct2/world/MapAnimation.h>
 #include <openrct2/world/Scenery.h>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <future>
 #include <stdio.h>
 #include <string>
 
@@ -124,6 +130,18 @@ static bool ExportSave(MemoryStream& stream, std::unique_ptr<IContext>& context)
     return true;
 }
 
+// Reads the header of a saved park back, to check how it was written.
+static void ExpectParkFileHeader(
+    MemoryStream& stream, OrcaStream::CompressionType compression, uint32_t targetVersion, uint32_t minVersion)
+{
+    stream.SetPosition(0);
+    OrcaStream os(stream, OrcaStream::Mode::READING);
+    const auto& header = os.GetHeader();
+    EXPECT_EQ(header.Compression, compression);
+    EXPECT_EQ(header.TargetVersion, targetVersion);
+    EXPECT_EQ(header.MinVersion, minVersion);
+}
+
 static void RecordGameStateSnapshot(std::unique_ptr<IContext>& context, MemoryStream& snapshotStream)
 {
     auto* snapshots = context->GetGameStateSnapshots();
@@ -278,6 +296,153 @@ TEST(S6ImportExportAdvanceTicks, all)
     SUCCEED();
 }
 
+TEST(S6ImportExportBlockCompression, all)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    MemoryStream importBuffer;
+    MemoryStream exportBuffer;
+    MemoryStream snapshotStream;
+
+    // Load initial park data and save it with the payload compressed in blocks.
+    {
+        std::unique_ptr<IContext> context = CreateContext();
+        EXPECT_NE(context, nullptr);
+
+        bool initialised = context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        std::string testParkPath = TestData::GetParkPath("BigMapTest.sv6");
+        ASSERT_TRUE(LoadFileToBuffer(importBuffer, testParkPath));
+        ASSERT_TRUE(ImportS6(importBuffer, context, false));
+        RecordGameStateSnapshot(context, snapshotStream);
+
+        // Without the option the park is saved as before, so older versions can still open it.
+        MemoryStream gzipBuffer;
+        ASSERT_TRUE(ExportSave(gzipBuffer, context));
+        ExpectParkFileHeader(gzipBuffer, OrcaStream::CompressionType::gzip, kParkFileGzipVersion, kParkFileMinVersion);
+
+        Config::Get().general.ParallelParkCompression = true;
+        bool exported = ExportSave(exportBuffer, context);
+        Config::Get().general.ParallelParkCompression = false;
+        ASSERT_TRUE(exported);
+        ExpectParkFileHeader(
+            exportBuffer, OrcaStream::CompressionType::gzipBlocks, kBlockCompressionVersion, kBlockCompressionVersion);
+    }
+
+    // Import the exported version.
+    {
+        std::unique_ptr<IContext> context = CreateContext();
+        EXPECT_NE(context, nullptr);
+
+        bool initialised = context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        ASSERT_TRUE(ImportPark(exportBuffer, context, true));
+
+        RecordGameStateSnapshot(context, snapshotStream);
+    }
+
+    snapshotStream.SetPosition(0);
+    CompareStates(importBuffer, exportBuffer, snapshotStream);
+
+    SUCCEED();
+}
+
+TEST(S6ImportExportDeferredSave, all)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    std::unique_ptr<IContext> context = CreateContext();
+    EXPECT_NE(context, nullptr);
+
+    bool initialised = context->Initialise();
+    ASSERT_TRUE(initialised);
+
+    MemoryStream importBuffer;
+    std::string testParkPath = TestData::GetParkPath("BigMapTest.sv6");
+    ASSERT_TRUE(LoadFileToBuffer(importBuffer, testParkPath));
+    ASSERT_TRUE(ImportS6(importBuffer, context, false));
+    AdvanceGameTicks(100, context);
+
+    auto tempDirectory = std::filesystem::temp_directory_path().string();
+    auto syncPath = Path::Combine(tempDirectory, u8"openrct2-save-sync.park");
+    auto deferredPath = Path::Combine(tempDirectory, u8"openrct2-save-deferred.park");
+    constexpr int32_t kSaveFlagAutomatic = 0x80000000;
+
+    // The saves hold the time they were made at, retry if the clock ticked over in between.
+    bool compared = false;
+    for (int32_t attempt = 0; attempt < 3 && !compared; attempt++)
+    {
+        const auto startTime = std::time(nullptr);
+        auto& gameState = GetGameState();
+        ASSERT_TRUE(ScenarioSave(gameState, syncPath, kSaveFlagAutomatic));
+
+        auto writeSave = ScenarioSaveDeferred(gameState, deferredPath, kSaveFlagAutomatic);
+        ASSERT_TRUE(writeSave);
+        ASSERT_TRUE(std::async(std::launch::async, writeSave).get());
+        if (std::time(nullptr) != startTime)
+            continue;
+
+        ASSERT_EQ(File::ReadAllBytes(syncPath), File::ReadAllBytes(deferredPath));
+        compared = true;
+    }
+
+    File::Delete(syncPath);
+    File::Delete(deferredPath);
+    ASSERT_TRUE(compared) << "every attempt crossed a second boundary";
+}
+
+TEST(S6ImportExportSnapshotDeltas, all)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    std::unique_ptr<IContext> context = CreateContext();
+    EXPECT_NE(context, nullptr);
+
+    bool initialised = context->Initialise();
+    ASSERT_TRUE(initialised);
+
+    MemoryStream importBuffer;
+    std::string testParkPath = TestData::GetParkPath("BigMapTest.sv6");
+    ASSERT_TRUE(LoadFileToBuffer(importBuffer, testParkPath));
+    ASSERT_TRUE(ImportS6(importBuffer, context, false));
+
+    auto* snapshots = context->GetGameStateSnapshots();
+    snapshots->Reset();
+
+    // Older snapshots are only kept as differences, they must restore to what was captured.
+    constexpr uint32_t kNumTicks = 40;
+    std::vector<MemoryStream> captured(kNumTicks);
+    for (uint32_t i = 0; i < kNumTicks; i++)
+    {
+        AdvanceGameTicks(1, context);
+        RecordGameStateSnapshot(context, captured[i]);
+    }
+
+    const auto lastTick = GetGameState().CurrentTicks;
+    for (uint32_t i = 0; i < kNumTicks; i++)
+    {
+        const auto tick = lastTick - (kNumTicks - 1) + i;
+        const auto* snapshot = snapshots->GetLinkedSnapshot(tick);
+        if (i < kNumTicks - 32)
+        {
+            ASSERT_EQ(snapshot, nullptr);
+            continue;
+        }
+        ASSERT_NE(snapshot, nullptr);
+
+        MemoryStream restored;
+        DataSerialiser ds(true, restored);
+        snapshots->SerialiseSnapshot(const_cast<GameStateSnapshot_t&>(*snapshot), ds);
+        ASSERT_EQ(restored.GetLength(), captured[i].GetLength());
+        ASSERT_EQ(std::memcmp(restored.GetData(), captured[i].GetData(), restored.GetLength()), 0);
+    }
+}
+
 TEST(SeaDecrypt, DecryptSea)
 {
     auto path = TestData::GetParkPath("volcania.sea");
@@ -0,0 +1,150 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <array>
+#include <gtest/gtest.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/platform/Platform.h>
+#include <random>
+#include <vector>
+
+using namespace OpenRCT2;
+
+using CopyRowFunc = void (*)(const uint8_t*, uint8_t*, int32_t);
+using RemapRowFunc = void (*)(const uint8_t*, uint8_t*, int32_t, const uint8_t*);
+
+class SpriteBlitTest : public testing::Test
+{
+protected:
+    static constexpr int32_t kMaxRowLength = 200;
+    // Rows start at every offset of a vector so unaligned loads and stores are covered.
+    static constexpr int32_t kMaxRowOffset = 32;
+
+    std::mt19937 _rng{ 5678 };
+
+    // Bytes with roughly one in four set to zero, the transparent colour.
+    std::vector<uint8_t> CreatePixels(size_t count)
+    {
+        std::vector<uint8_t> pixels(count);
+        for (auto& pixel : pixels)
+        {
+            pixel = _rng() % 4 == 0 ? 0 : static_cast<uint8_t>(_rng());
+        }
+        return pixels;
+    }
+
+    void TestCopyRow(CopyRowFunc func)
+    {
+        for (int32_t count = 0; count <= kMaxRowLength; count++)
+        {
+            const auto offset = static_cast<size_t>(_rng() % kMaxRowOffset);
+            const auto src = CreatePixels(count + offset);
+            const auto dst = CreatePixels(count + offset);
+
+            auto expected = dst;
+            CopyTransparentRowScalar(src.data() + offset, expected.data() + offset, count);
+            auto actual = dst;
+            func(src.data() + offset, actual.data() + offset, count);
+            ASSERT_EQ(actual, expected) << "count " << count;
+        }
+    }
+
+    void TestRemapRow(RemapRowFunc scalarFunc, RemapRowFunc func)
+    {
+        for (int32_t count = 0; count <= kMaxRowLength; count++)
+        {
+            const auto offset = static_cast<size_t>(_rng() % kMaxRowOffset);
+            const auto paletteMap = CreatePixels(256);
+            const auto src = CreatePixels(count + offset);
+            const auto dst = CreatePixels(count + offset);
+
+            auto expected = dst;
+            scalarFunc(src.data() + offset, expected.data() + offset, count, paletteMap.data());
+            auto actual = dst;
+            func(src.data() + offset, actual.data() + offset, count, paletteMap.data());
+            ASSERT_EQ(actual, expected) << "count " << count;
+        }
+    }
+
+    template<DrawBlendOp TBlendOp>
+    void TestBlitRow(size_t mapLength)
+    {
+        for (int32_t count = 0; count <= kMaxRowLength; count++)
+        {
+            auto paletteMapData = CreatePixels(mapLength);
+            const PaletteMap paletteMap(paletteMapData.data(), 1, mapLength);
+            auto src = CreatePixels(count);
+            auto dst = CreatePixels(count);
+            for (auto& pixel : src)
+            {
+                pixel %= mapLength;
+            }
+            for (auto& pixel : dst)
+            {
+                pixel %= mapLength;
+            }
+
+            auto expected = dst;
+            for (int32_t x = 0; x < count; x++)
+            {
+                BlitPixel<TBlendOp>(src.data() + x, expected.data() + x, paletteMap);
+            }
+            auto actual = dst;
+            BlitRow<TBlendOp>(src.data(), actual.data(), count, paletteMap);
+            ASSERT_EQ(actual, expected) << "count " << count;
+        }
+    }
+};
+
+TEST_F(SpriteBlitTest, copy_transparent_row_matches_scalar)
+{
+    if (Platform::SSE41Available())
+    {
+        TestCopyRow(CopyTransparentRowSse4_1);
+    }
+    if (Platform::AVX2Available())
+    {
+        TestCopyRow(CopyTransparentRowAvx2);
+    }
+}
+
+TEST_F(SpriteBlitTest, remap_src_row_matches_scalar)
+{
+    if (Platform::SSE41Available())
+    {
+        TestRemapRow(RemapSrcRowScalar, RemapSrcRowSse4_1);
+    }
+    if (Platform::AVX2Available())
+    {
+        TestRemapRow(RemapSrcRowScalar, RemapSrcRowAvx2);
+    }
+}
+
+TEST_F(SpriteBlitTest, remap_dst_row_matches_scalar)
+{
+    if (Platform::SSE41Available())
+    {
+        TestRemapRow(RemapDstRowScalar, RemapDstRowSse4_1);
+    }
+    if (Platform::AVX2Available())
+    {
+        TestRemapRow(RemapDstRowScalar, RemapDstRowAvx2);
+    }
+}
+
+TEST_F(SpriteBlitTest, blit_row_matches_blit_pixel)
+{
+    TestBlitRow<kBlendNone>(256);
+    TestBlitRow<kBlendTransparent>(256);
+    TestBlitRow<kBlendTransparent | kBlendSrc>(256);
+    TestBlitRow<kBlendTransparent | kBlendDst>(256);
+    // Maps shorter than a full palette fall back to BlitPixel.
+    TestBlitRow<kBlendTransparent | kBlendSrc>(8);
+    TestBlitRow<kBlendTransparent | kBlendDst>(8);
+}
@@ -0,0 +1,126 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <limits>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/entity/EntityList.h>
+#include <openrct2/entity/EntityRegistry.h>
+#include <openrct2/entity/Staff.h>
+#include <openrct2/entity/StaffSpatialIndex.h>
+
+using namespace OpenRCT2;
+
+class StaffSpatialIndexTests : public testing::Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        _context = CreateContext();
+        bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        GetContext()->LoadParkFromFile(TestData::GetParkPath("bpb.sv6"));
+        GameLoadInit();
+
+        // Clusters of staff on the same spots so there are ties in distance.
+        uint32_t seed = 12345;
+        for (int32_t i = 0; i < 300; i++)
+        {
+            seed = seed * 1103515245 + 12345;
+            auto* staff = CreateEntity<Staff>();
+            ASSERT_NE(staff, nullptr);
+            staff->AssignedStaffType = (i % 3) == 0 ? StaffType::Handyman : StaffType::Mechanic;
+            if ((i % 17) == 0)
+            {
+                staff->MoveTo({ kLocationNull, 0, 0 });
+            }
+            else
+            {
+                const auto x = static_cast<int32_t>((seed >> 8) % 40) * 128;
+                const auto y = static_cast<int32_t>((seed >> 16) % 40) * 128;
+                staff->MoveTo({ x, y, 0 });
+            }
+        }
+    }
+
+    static void TearDownTestCase()
+    {
+        _context.reset();
+    }
+
+    // Same search as a scan of all staff in sprite order.
+    template<typename TPredicate>
+    static Staff* ScanClosest(StaffType type, const CoordsXY& loc, TPredicate&& isAvailable)
+    {
+        Staff* closest = nullptr;
+        uint32_t closestDistance = std::numeric_limits<uint32_t>::max();
+        for (auto* staff : EntityList<Staff>())
+        {
+            if (staff->AssignedStaffType != type || staff->x == kLocationNull || !isAvailable(*staff))
+                continue;
+
+            uint32_t distance = std::abs(staff->x - loc.x) + std::abs(staff->y - loc.y);
+            if (distance < closestDistance)
+            {
+                closestDistance = distance;
+                closest = staff;
+            }
+        }
+        return closest;
+    }
+
+private:
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> StaffSpatialIndexTests::_context;
+
+TEST_F(StaffSpatialIndexTests, FindClosestMatchesScan)
+{
+    StaffSpatialIndex index;
+    index.Build();
+    ASSERT_TRUE(index.IsBuilt());
+
+    auto anyStaff = [](const Staff&) { return true; };
+    auto someStaff = [](const Staff& staff) { return (staff.Id.ToUnderlying() % 5) != 0; };
+    for (int32_t y = 0; y < 6000; y += 160)
+    {
+        for (int32_t x = 0; x < 6000; x += 160)
+        {
+            const CoordsXY loc{ x + 16, y + 16 };
+            for (auto type : { StaffType::Mechanic, StaffType::Handyman })
+            {
+                ASSERT_EQ(index.FindClosest(type, loc, anyStaff), ScanClosest(type, loc, anyStaff));
+                ASSERT_EQ(index.FindClosest(type, loc, someStaff), ScanClosest(type, loc, someStaff));
+            }
+        }
+    }
+}
+
+TEST_F(StaffSpatialIndexTests, NoneAvailable)
+{
+    StaffSpatialIndex index;
+    index.Build();
+
+    auto noStaff = [](const Staff&) { return false; };
+    ASSERT_EQ(index.FindClosest(StaffType::Mechanic, { 1000, 1000 }, noStaff), nullptr);
+    ASSERT_EQ(index.FindClosest(StaffType::Entertainer, { 1000, 1000 }, noStaff), nullptr);
+
+    index.Clear();
+    ASSERT_FALSE(index.IsBuilt());
+}
@@ -0,0 +1,118 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <openrct2/core/TaskScheduler.h>
+#include <thread>
+#include <vector>
+
+using namespace OpenRCT2;
+
+TEST(TaskSchedulerTest, wait_without_tasks)
+{
+    TaskScheduler scheduler;
+    TaskGroup group(scheduler);
+    group.Wait();
+    ASSERT_GE(scheduler.GetNumThreads(), 1u);
+}
+
+TEST(TaskSchedulerTest, runs_all_tasks)
+{
+    TaskScheduler scheduler(4);
+    std::atomic<int> counter{};
+    TaskGroup group(scheduler);
+    for (int i = 0; i < 10000; i++)
+    {
+        group.Run([&counter]() { counter++; });
+    }
+    group.Wait();
+    ASSERT_EQ(counter.load(), 10000);
+
+    // Groups can be reused after waiting.
+    group.Run([&counter]() { counter++; });
+    group.Wait();
+    ASSERT_EQ(counter.load(), 10001);
+}
+
+TEST(TaskSchedulerTest, parallel_for_covers_range_once)
+{
+    TaskScheduler scheduler(4);
+    std::vector<int> visited(100003);
+    scheduler.ParallelFor(3, visited.size(), 1000, [&visited](size_t first, size_t last) {
+        for (auto i = first; i < last; i++)
+        {
+            visited[i]++;
+        }
+    });
+    for (size_t i = 0; i < visited.size(); i++)
+    {
+        ASSERT_EQ(visited[i], i < 3 ? 0 : 1);
+    }
+}
+
+TEST(TaskSchedulerTest, nested_groups)
+{
+    TaskScheduler scheduler(2);
+    std::atomic<int> counter{};
+    scheduler.ParallelFor(0, 16, 1, [&](size_t, size_t) {
+        scheduler.ParallelFor(0, 100, 10, [&](size_t first, size_t last) { counter += static_cast<int>(last - first); });
+    });
+    ASSERT_EQ(counter.load(), 1600);
+}
+
+TEST(TaskSchedulerTest, wait_reports_progress)
+{
+    TaskScheduler scheduler(2);
+    std::atomic<bool> started{};
+    std::atomic<int> numReports{};
+    TaskGroup group(scheduler);
+    // The task keeps the group busy until a report arrives, the timeout only prevents a hang if none ever does.
+    group.Run([&started, &numReports]() {
+        started = true;
+        const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (numReports == 0 && std::chrono::steady_clock::now() < timeout)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    // Once a worker runs the task Wait has nothing to help with and has to report while it waits.
+    while (!started)
+    {
+        std::this_thread::yield();
+    }
+    group.Wait([&numReports]() { numReports++; });
+    ASSERT_GT(numReports.load(), 0);
+}
+
+TEST(TaskSchedulerTest, shared_scheduler_is_one_pool)
+{
+    auto& scheduler = TaskScheduler::GetShared();
+    ASSERT_EQ(&scheduler, &TaskScheduler::GetShared());
+    ASSERT_GE(scheduler.GetNumThreads(), 1u);
+
+    // Groups from several threads at once all run on the same workers.
+    std::atomic<int> counter{};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++)
+    {
+        threads.emplace_back([&counter]() {
+            TaskScheduler::GetShared().ParallelFor(0, 1000, 10, [&counter](size_t first, size_t last) {
+                counter += static_cast<int>(last - first);
+            });
+        });
+    }
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+    ASSERT_EQ(counter.load(), 4000);
+}